@@ -1,69 +1,595 @@
-
 #pragma once
 
+#include <algorithm>
+#include <atom/arena_statistics.hpp>
+#include <atom/detail/address_sanitizer.hpp>
+#include <atom/detail/virtual_memory.hpp>
 #include <atom/integer.hpp>
+#include <atom/non_copyable.hpp>
 #include <atom/panic.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
-
-#if defined(WIN32)
-  #define WIN32_LEAN_AND_MEAN
-  #include <windows.h>
-#elif defined(__APPLE__)
-  #include <sys/mman.h>
-#endif
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 //#define ATOM_ARENA_USE_MALLOC
 
+// Checked arenas catch lifetime and overflow bugs at the cost of memory and speed (set ATOM_ARENA_CHECKED in CMake).
+//#define ATOM_ARENA_CHECKED
+
 namespace atom {
 
-class Arena {
+/**
+ * Typed allocation helpers shared by all arena types.
+ * The derived class provides `void* Allocate(size_t number_of_bytes, size_t alignment)`.
+ */
+template<typename Derived>
+class ArenaBase {
   public:
-    explicit Arena(size_t capacity) {
-#if defined(WIN32) && !defined(ATOM_ARENA_USE_MALLOC)
-      m_base_address = (u8*)VirtualAlloc(nullptr, capacity, MEM_COMMIT, PAGE_READWRITE);
-#elif defined(__APPLE__) && !defined(ATOM_ARENA_USE_MALLOC)
-      m_base_address = (u8*)mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-#else
+    /**
+     * Allocate uninitialized storage for an array.
+     * @param count the number of elements
+     * @returns a pointer to the storage or nullptr if the arena is exhausted
+     */
+    template<typename T>
+    T* AllocateArray(size_t count) {
+      if(count > ~size_t{0} / sizeof(T)) {
+        return nullptr;
+      }
+      return (T*)static_cast<Derived*>(this)->Allocate(sizeof(T) * count, alignof(T));
+    }
+
+    /**
+     * Allocate and construct an object. Its destructor is never run by the arena.
+     * @param args the arguments for the constructor
+     * @returns a pointer to the object or nullptr if the arena is exhausted
+     */
+    template<typename T, typename... Args>
+    T* New(Args&&... args) {
+      void* address = static_cast<Derived*>(this)->Allocate(sizeof(T), alignof(T));
+      if(address == nullptr) {
+        return nullptr;
+      }
+      return new(address) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Allocate an array of value-initialized objects. Their destructors are never run by the arena.
+     * @param count the number of elements
+     * @returns a pointer to the first element or nullptr if the arena is exhausted
+     */
+    template<typename T>
+    T* NewArray(size_t count) {
+      T* elements = AllocateArray<T>(count);
+      if(elements != nullptr) {
+        for(size_t i = 0; i < count; i++) {
+          new(&elements[i]) T();
+        }
+      }
+      return elements;
+    }
+};
+
+/**
+ * A linear allocator, which allocates memory by advancing a pointer through a fixed-size buffer.
+ * Individual allocations cannot be freed, instead the whole arena is reset at once.
+ *
+ * The arena reserves its full capacity as virtual address space up front, but only commits memory
+ * in chunks of {@link #k_commit_granularity} bytes as allocations cross the committed watermark.
+ * This makes it cheap to size arenas for the worst case.
+ *
+ * Large, randomly accessed arenas can be backed by huge pages to reduce TLB misses (@see #Options).
+ *
+ * When ATOM_ARENA_CHECKED is defined, each allocation is preceded by a header and followed by a redzone.
+ * Freed memory is filled with {@link #k_freed_pattern} (and poisoned under AddressSanitizer), and the redzones
+ * and freed memory are validated on {@link #Reset}, {@link #Rewind} and reuse, which panics on corruption.
+ * Optionally, each allocation ends at a guard page and freed memory is decommitted, so that overflows and
+ * accesses after a reset fault immediately.
+ *
+ * Objects created with {@link #New} and {@link #NewArray} are never destroyed by the arena:
+ * their destructors do not run on {@link #Reset} or {@link #Rewind}.
+ */
+class Arena : public ArenaBase<Arena>, NonCopyable {
+  public:
+    /// The granularity in which memory is committed as the arena grows
+    static constexpr size_t k_commit_granularity = 64 * 1024;
+
+    /// The kind of pages that back the memory of an arena
+    enum class HugePages {
+      /// Regular pages
+      None,
+      /// Transparent huge pages (madvise(MADV_HUGEPAGE) on Linux), which the kernel may or may not provide
+      Transparent,
+      /// Explicit huge pages from the preallocated pool (MAP_HUGETLB on Linux). Falls back to Transparent if the pool is too small.
+      Explicit
+    };
+
+    struct Options {
+      /// The kind of pages to back the arena with. Huge pages round the capacity and commit granularity up to 2 MiB.
+      HugePages huge_pages = HugePages::None;
+      /// Whether to fault in memory as it is committed, so that allocations do not incur page faults later
+      bool populate = false;
+      /// The NUMA node to allocate the memory from or -1 to use the default policy of the calling thread (Linux only, @see #IsNumaBound)
+      int numa_node = -1;
+      /// The name to list the arena under in statistics reports (@see #get_arena_reports). Ignored unless ATOM_ARENA_STATISTICS is defined.
+      const char* name = nullptr;
+      /// Whether to place a guard page after each allocation. Disables huge pages. Ignored unless ATOM_ARENA_CHECKED is defined.
+      bool guard_pages = false;
+    };
+
+#if defined(ATOM_ARENA_CHECKED)
+    /// The size of the redzone after each allocation
+    static constexpr size_t k_redzone_size = 16;
+
+    /// The byte pattern of new allocations
+    static constexpr u8 k_uninitialized_pattern = 0xCD;
+
+    /// The byte pattern of redzones
+    static constexpr u8 k_redzone_pattern = 0xFD;
+
+    /// The byte pattern of freed memory
+    static constexpr u8 k_freed_pattern = 0xDD;
+#endif
+
+    /// @param capacity the maximum number of bytes that can be allocated (rounded up to the page size)
+    explicit Arena(size_t capacity) : Arena{capacity, Options{}} {}
+
+    /**
+     * @param capacity the maximum number of bytes that can be allocated (rounded up to the page size)
+     * @param options  the options for the backing memory
+     */
+    Arena(size_t capacity, Options const& options) {
+#if defined(ATOM_ARENA_USE_MALLOC)
+      (void)options;
       m_base_address = (u8*)std::malloc(capacity);
+      m_committed_address = m_base_address + capacity;
+#else
+      m_huge_pages = options.huge_pages;
+      m_populate = options.populate;
+
+#if defined(ATOM_ARENA_CHECKED)
+      // Guard pages are protected one regular page at a time.
+      m_guard_pages = options.guard_pages;
+      if(m_guard_pages) {
+        m_page_size = detail::get_page_size();
+        m_commit_granularity = m_page_size;
+        m_huge_pages = HugePages::None;
+      }
+#endif
+
+      if(m_huge_pages != HugePages::None) {
+        capacity = std::max<size_t>((capacity + detail::k_huge_page_size - 1u) & ~(detail::k_huge_page_size - 1u), detail::k_huge_page_size);
+        m_commit_granularity = detail::k_huge_page_size;
+
+        if(m_huge_pages == HugePages::Explicit) {
+          m_base_address = (u8*)detail::reserve_huge_page_virtual_memory(capacity);
+          if(m_base_address == nullptr) {
+            m_huge_pages = HugePages::Transparent;
+          }
+        }
+
+        if(m_huge_pages == HugePages::Transparent) {
+          m_base_address = (u8*)detail::reserve_aligned_virtual_memory(capacity, detail::k_huge_page_size);
+          if(m_base_address != nullptr && !detail::advise_huge_pages(m_base_address, capacity)) {
+            m_huge_pages = HugePages::None;
+          }
+        }
+      } else {
+        const size_t page_size = detail::get_page_size();
+
+        capacity = std::max<size_t>((capacity + page_size - 1u) & ~(page_size - 1u), page_size);
+        m_base_address = (u8*)detail::reserve_virtual_memory(capacity);
+      }
+
+      if(m_base_address != nullptr && options.numa_node >= 0) {
+        m_numa_bound = detail::bind_to_numa_node(m_base_address, capacity, options.numa_node);
+      }
+      m_committed_address = m_base_address;
 #endif
 
       if(m_base_address == nullptr) {
         ATOM_PANIC("atom: out of memory");
       }
       m_maximum_address = m_base_address + capacity;
-      Reset();
+      m_current_address = m_base_address;
+
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordCommittedSize(GetCommittedSize());
+      if(options.name != nullptr) {
+        detail::register_arena(this, options.name);
+        m_registered = true;
+      }
+#endif
     }
 
    ~Arena() {
-      const size_t capacity = m_maximum_address - m_base_address;
+#if defined(ATOM_ARENA_STATISTICS)
+      if(m_registered) {
+        detail::unregister_arena(this);
+      }
+#endif
 
-#if defined(WIN32) && !defined(ATOM_ARENA_USE_MALLOC)
-      VirtualFree(m_base_address, capacity, MEM_RELEASE);
-#elif defined(__APPLE__) && !defined(ATOM_ARENA_USE_MALLOC)
-      munmap(m_base_address, capacity);
-#else
-     (void)capacity;
+#if defined(ATOM_ARENA_CHECKED)
+      // Validate the allocations that were never freed and hand the memory back to AddressSanitizer unpoisoned.
+      detail::unpoison_memory(m_base_address, std::max(GetUsedSize(), m_freed_end_offset));
+      for(CheckedHeader* header = m_last_allocation; header != nullptr; header = header->previous) {
+        ValidateAllocation(header);
+      }
+#endif
+
+#if defined(ATOM_ARENA_USE_MALLOC)
       std::free(m_base_address);
+#else
+      detail::release_virtual_memory(m_base_address, GetCapacity());
 #endif
     }
 
-    void Reset() {
+    /**
+     * Free all allocations at once.
+     * @param decommit whether to return the committed memory to the operating system.
+     *                 Otherwise it is kept to serve future allocations without faulting.
+     */
+    void Reset(bool decommit = false) {
+#if defined(ATOM_ARENA_CHECKED)
+      ReleaseChecked(0u);
+#endif
       m_current_address = m_base_address;
+
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordReset();
+#endif
+
+#if !defined(ATOM_ARENA_USE_MALLOC)
+      if(decommit && m_committed_address != m_base_address) {
+        detail::decommit_virtual_memory(m_base_address, GetCommittedSize());
+        m_committed_address = m_base_address;
+#if defined(ATOM_ARENA_CHECKED)
+        m_freed_end_offset = 0u;
+#endif
+#if defined(ATOM_ARENA_STATISTICS)
+        m_counters.RecordCommittedSize(0u);
+#endif
+      }
+#else
+      (void)decommit;
+#endif
     }
 
-    void* Allocate(size_t number_of_bytes) {
-      u8* address = m_current_address;
-      m_current_address += number_of_bytes;
-      if(m_current_address <= m_maximum_address) {
-        return address;
+    /// A position in the arena, which allocations can be rolled back to (@see #GetMarker, #Rewind)
+    struct Marker {
+      size_t offset;
+    };
+
+    /**
+     * Allocate a block of memory.
+     * @param number_of_bytes the size of the block
+     * @param alignment       the alignment of the block, which must be a power of two
+     * @returns a pointer to the block or nullptr if the arena is exhausted
+     */
+    void* Allocate(size_t number_of_bytes, size_t alignment = alignof(std::max_align_t)) {
+      ATOM_ASSERT(alignment != 0u && (alignment & (alignment - 1u)) == 0u, "atom: alignment must be a power of two: {}", alignment)
+
+#if defined(ATOM_ARENA_CHECKED)
+      u8* address = AllocateChecked(number_of_bytes, alignment);
+      if(address == nullptr) {
+        return AllocationFailed();
       }
-      return nullptr;
+#else
+      const size_t padding = (size_t)(-(std::uintptr_t)m_current_address & (alignment - 1u));
+      const size_t available_bytes = (size_t)(m_maximum_address - m_current_address);
+
+      if(padding > available_bytes || number_of_bytes > available_bytes - padding) {
+        return AllocationFailed();
+      }
+
+      u8* address = m_current_address + padding;
+      u8* next_address = address + number_of_bytes;
+
+      if(next_address > m_committed_address && !Commit(next_address)) {
+        return AllocationFailed();
+      }
+      m_current_address = next_address;
+#endif
+
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordAllocation(number_of_bytes, GetUsedSize());
+#endif
+      return address;
+    }
+
+    /**
+     * Free the most recent allocation, which allows a block at the end of the arena to be reallocated in place.
+     * @param address         the address of the block
+     * @param number_of_bytes the size of the block
+     * @returns whether the block was the most recent allocation and has been freed
+     */
+    bool FreeLast(void* address, size_t number_of_bytes) {
+#if defined(ATOM_ARENA_CHECKED)
+      if(m_last_allocation == nullptr || (u8*)(m_last_allocation + 1) != address) {
+        return false;
+      }
+
+      detail::unpoison_memory(m_last_allocation, sizeof(CheckedHeader));
+      const size_t size = m_last_allocation->size;
+      const size_t previous_offset = m_last_allocation->previous_offset;
+      detail::poison_memory(m_last_allocation, sizeof(CheckedHeader));
+
+      if(size != number_of_bytes) {
+        return false;
+      }
+      ReleaseChecked(previous_offset);
+      m_current_address = m_base_address + previous_offset;
+#else
+      if((u8*)address + number_of_bytes != m_current_address || !Owns(address)) {
+        return false;
+      }
+      m_current_address = (u8*)address;
+#endif
+
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordUsedSize(GetUsedSize());
+#endif
+      return true;
+    }
+
+    /// @returns whether an address lies within the memory of the arena
+    [[nodiscard]] bool Owns(const void* address) const {
+      return (std::uintptr_t)address >= (std::uintptr_t)m_base_address &&
+             (std::uintptr_t)address <  (std::uintptr_t)m_maximum_address;
+    }
+
+    /// @returns a marker for the current position in the arena
+    [[nodiscard]] Marker GetMarker() const {
+      return {GetUsedSize()};
+    }
+
+    /**
+     * Free all allocations that were made after a marker was taken.
+     * Markers must be rewound to in LIFO order (@see #ArenaScope).
+     * @param marker the marker
+     */
+    void Rewind(Marker marker) {
+      ATOM_ASSERT(marker.offset <= GetUsedSize(), "atom: arena marker is ahead of the current position")
+
+#if defined(ATOM_ARENA_CHECKED)
+      ReleaseChecked(marker.offset);
+#endif
+      m_current_address = m_base_address + marker.offset;
+
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordUsedSize(marker.offset);
+#endif
+    }
+
+    /// @returns the maximum number of bytes that can be allocated
+    [[nodiscard]] size_t GetCapacity() const {
+      return (size_t)(m_maximum_address - m_base_address);
+    }
+
+    /// @returns the number of bytes that are currently allocated
+    [[nodiscard]] size_t GetUsedSize() const {
+      return (size_t)(m_current_address - m_base_address);
     }
 
+    /// @returns the number of bytes that are currently backed by committed memory
+    [[nodiscard]] size_t GetCommittedSize() const {
+      return (size_t)(m_committed_address - m_base_address);
+    }
+
+    /// @returns the kind of pages that were requested for the arena and are available on this system
+    [[nodiscard]] HugePages GetHugePages() const {
+      return m_huge_pages;
+    }
+
+    /// @returns whether the memory of the arena is bound to the NUMA node that was requested in its options
+    [[nodiscard]] bool IsNumaBound() const {
+      return m_numa_bound;
+    }
+
+#if defined(ATOM_ARENA_STATISTICS)
+    /**
+     * Take a snapshot of the usage statistics of the arena.
+     * Safe to call from any thread, while the owning thread is using the arena.
+     */
+    [[nodiscard]] ArenaStatistics GetStatistics() const {
+      return m_counters.GetStatistics(GetCapacity());
+    }
+#endif
+
   private:
+    bool Commit(u8* address) {
+      const size_t offset = (size_t)(address - m_base_address);
+      const size_t committed_size = std::min(
+        (offset + m_commit_granularity - 1u) & ~(m_commit_granularity - 1u), GetCapacity());
+      const size_t commit_size = committed_size - GetCommittedSize();
+
+      if(!detail::commit_virtual_memory(m_committed_address, commit_size)) {
+        return false;
+      }
+      if(m_populate) {
+        detail::populate_virtual_memory(m_committed_address, commit_size);
+      }
+      m_committed_address = m_base_address + committed_size;
+
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordCommittedSize(committed_size);
+#endif
+      return true;
+    }
+
+#if defined(ATOM_ARENA_CHECKED)
+    /// Precedes each allocation in checked mode. The headers form a list from the most recent allocation backwards.
+    struct CheckedHeader {
+      u64 magic;
+      size_t size;
+      size_t previous_offset;     ///< the used size before the allocation
+      size_t redzone_end_offset;  ///< the end of the redzone after the allocation
+      CheckedHeader* previous;
+    };
+
+    static constexpr u64 k_checked_header_magic = 0xA7E3A5E4A11C0C8Dull;
+
+    u8* AllocateChecked(size_t number_of_bytes, size_t alignment) {
+      alignment = std::max(alignment, alignof(CheckedHeader));
+
+      const size_t used_size = GetUsedSize();
+      const size_t capacity = GetCapacity();
+
+      if(number_of_bytes > capacity || alignment > capacity) {
+        return nullptr;
+      }
+
+      const std::uintptr_t base_address = (std::uintptr_t)m_base_address;
+      const std::uintptr_t alignment_mask = alignment - 1u;
+
+      size_t data_offset = (size_t)(((base_address + used_size + sizeof(CheckedHeader) + alignment_mask) & ~alignment_mask) - base_address);
+      size_t redzone_end_offset;
+      size_t next_offset;
+
+      if(m_guard_pages) {
+        // Move the block up, so that it ends as close to the guard page as its alignment allows.
+        redzone_end_offset = (data_offset + number_of_bytes + m_page_size - 1u) & ~(m_page_size - 1u);
+        data_offset = (size_t)(((base_address + redzone_end_offset - number_of_bytes) & ~alignment_mask) - base_address);
+        next_offset = redzone_end_offset + m_page_size;
+      } else {
+        redzone_end_offset = data_offset + number_of_bytes + k_redzone_size;
+        next_offset = redzone_end_offset;
+      }
+
+      u8* next_address = m_base_address + next_offset;
+
+      if(next_offset > capacity || (next_address > m_committed_address && !Commit(next_address))) {
+        return nullptr;
+      }
+
+      // Writes through dangling pointers after a Reset or Rewind leave the freed pattern damaged.
+      detail::unpoison_memory(m_current_address, next_offset - used_size);
+      for(size_t offset = used_size; offset < std::min(next_offset, m_freed_end_offset); offset++) {
+        if(m_base_address[offset] != k_freed_pattern) {
+          ATOM_PANIC("atom: arena memory at offset {} was written to after it was freed", offset);
+        }
+      }
+
+      u8* address = m_base_address + data_offset;
+      auto header = (CheckedHeader*)(address - sizeof(CheckedHeader));
+
+      *header = {k_checked_header_magic, number_of_bytes, used_size, redzone_end_offset, m_last_allocation};
+      m_last_allocation = header;
+
+      std::memset(address, k_uninitialized_pattern, number_of_bytes);
+      std::memset(address + number_of_bytes, k_redzone_pattern, redzone_end_offset - data_offset - number_of_bytes);
+
+      if(m_guard_pages) {
+        detail::decommit_virtual_memory(m_base_address + redzone_end_offset, m_page_size);
+      }
+
+      detail::poison_memory(m_current_address, next_offset - used_size);
+      detail::unpoison_memory(address, number_of_bytes);
+
+      m_current_address = next_address;
+      m_freed_end_offset = std::max(m_freed_end_offset, next_offset);
+      return address;
+    }
+
+    /// Validate and free all allocations after an offset. The memory must not be poisoned.
+    void ReleaseChecked(size_t offset) {
+      const size_t used_size = GetUsedSize();
+
+      detail::unpoison_memory(m_base_address + offset, used_size - offset);
+
+      while(m_last_allocation != nullptr && (u8*)m_last_allocation >= m_base_address + offset) {
+        ValidateAllocation(m_last_allocation);
+        m_last_allocation = m_last_allocation->previous;
+      }
+
+      if(m_guard_pages) {
+        // Decommit the freed pages, so that any access through a dangling pointer faults.
+        if(m_committed_address > m_base_address + offset) {
+          detail::decommit_virtual_memory(m_base_address + offset, (size_t)(m_committed_address - m_base_address) - offset);
+          m_committed_address = m_base_address + offset;
+#if defined(ATOM_ARENA_STATISTICS)
+          m_counters.RecordCommittedSize(offset);
+#endif
+        }
+        m_freed_end_offset = offset;
+      } else {
+        std::memset(m_base_address + offset, k_freed_pattern, used_size - offset);
+        m_freed_end_offset = std::max(m_freed_end_offset, used_size);
+        detail::poison_memory(m_base_address + offset, used_size - offset);
+      }
+    }
+
+    void ValidateAllocation(const CheckedHeader* header) const {
+      const size_t header_offset = (size_t)((const u8*)header - m_base_address);
+
+      if(header->magic != k_checked_header_magic) {
+        ATOM_PANIC("atom: arena allocation header at offset {} was overwritten", header_offset);
+      }
+
+      const u8* redzone = (const u8*)(header + 1) + header->size;
+      const u8* redzone_end = m_base_address + header->redzone_end_offset;
+
+      for(const u8* byte = redzone; byte != redzone_end; byte++) {
+        if(*byte != k_redzone_pattern) {
+          ATOM_PANIC("atom: arena allocation at offset {} ({} bytes) was overrun by {} bytes",
+            header_offset + sizeof(CheckedHeader), header->size, (size_t)(byte - redzone) + 1u);
+        }
+      }
+    }
+#endif
+
+    void* AllocationFailed() {
+#if defined(ATOM_ARENA_STATISTICS)
+      m_counters.RecordFailedAllocation();
+#endif
+      return nullptr;
+    }
+
     u8* m_base_address{};
     u8* m_current_address{};
+    u8* m_committed_address{};
     u8* m_maximum_address{};
+    size_t m_commit_granularity{k_commit_granularity};
+    HugePages m_huge_pages{HugePages::None};
+    bool m_populate{};
+    bool m_numa_bound{};
+
+#if defined(ATOM_ARENA_CHECKED)
+    CheckedHeader* m_last_allocation{};
+    size_t m_freed_end_offset{}; ///< the memory from the current position up to this offset holds the freed pattern
+    size_t m_page_size{};
+    bool m_guard_pages{};
+#endif
+
+#if defined(ATOM_ARENA_STATISTICS)
+    detail::ArenaCounters m_counters{};
+    bool m_registered{};
+#endif
+};
+
+/**
+ * Rewinds an arena to the position it had when the scope was created, once the scope ends.
+ * This releases per-request or per-frame temporaries in LIFO order:
+ * `{ ArenaScope scope{arena}; auto data = arena.AllocateArray<float>(n); ... }`
+ * @tparam ArenaType the arena type, which provides `GetMarker()` and `Rewind(marker)`
+ */
+template<typename ArenaType = Arena>
+class ArenaScope : NonCopyable {
+  public:
+    explicit ArenaScope(ArenaType& arena) : m_arena{arena}, m_marker{arena.GetMarker()} {}
+
+   ~ArenaScope() {
+      m_arena.Rewind(m_marker);
+    }
+
+  protected:
+    ArenaType& m_arena;
+
+  private:
+    typename ArenaType::Marker m_marker;
 };
 
 }  // namespace atom
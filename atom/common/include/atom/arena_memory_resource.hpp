@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atom/arena.hpp>
+#include <atom/chained_arena.hpp>
+#include <memory_resource>
+
+namespace atom {
+
+/**
+ * A std::pmr::memory_resource that allocates from an {@link #Arena}, e.g. for use with std::pmr containers.
+ * Allocations that do not fit into the arena are passed to an upstream resource.
+ * Deallocating the most recent allocation returns its memory to the arena (which benefits containers that grow),
+ * all other deallocations of arena memory are no-ops until the arena is reset.
+ */
+class ArenaMemoryResource final : public std::pmr::memory_resource {
+  public:
+    /**
+     * @param arena    the arena, which must outlive the resource
+     * @param upstream the resource that serves allocations which do not fit into the arena.
+     *                 The default null_memory_resource() throws std::bad_alloc instead.
+     */
+    explicit ArenaMemoryResource(Arena& arena, std::pmr::memory_resource* upstream = std::pmr::null_memory_resource())
+        : m_arena{arena}
+        , m_upstream{upstream} {
+    }
+
+  protected:
+    void* do_allocate(size_t number_of_bytes, size_t alignment) override {
+      if(void* address = m_arena.Allocate(number_of_bytes, alignment)) {
+        return address;
+      }
+      return m_upstream->allocate(number_of_bytes, alignment);
+    }
+
+    void do_deallocate(void* address, size_t number_of_bytes, size_t alignment) override {
+      if(m_arena.Owns(address)) {
+        m_arena.FreeLast(address, number_of_bytes);
+      } else {
+        m_upstream->deallocate(address, number_of_bytes, alignment);
+      }
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+      return this == &other;
+    }
+
+  private:
+    Arena& m_arena;
+    std::pmr::memory_resource* m_upstream;
+};
+
+/**
+ * A std::pmr::memory_resource that allocates from a {@link #ChainedArena} and never frees individual allocations.
+ * Deallocation is a no-op, all memory is released at once when the arena is reset.
+ */
+class MonotonicArenaMemoryResource final : public std::pmr::memory_resource {
+  public:
+    /// @param arena the arena, which must outlive the resource
+    explicit MonotonicArenaMemoryResource(ChainedArena& arena) : m_arena{arena} {}
+
+  protected:
+    void* do_allocate(size_t number_of_bytes, size_t alignment) override {
+      return m_arena.Allocate(number_of_bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+      return this == &other;
+    }
+
+  private:
+    ChainedArena& m_arena;
+};
+
+}  // namespace atom
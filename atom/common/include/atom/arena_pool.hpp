@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atom/arena.hpp>
+#include <atom/non_copyable.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace atom {
+
+/**
+ * Recycles arenas between threads or tasks, so that not every user has to reserve (and fault in) a new arena.
+ * All arenas in a pool have the same capacity. Safe to use from multiple threads.
+ */
+class ArenaPool : NonCopyable {
+  public:
+    /// Released arenas that have committed more memory than this are decommitted before they are pooled
+    static constexpr size_t k_max_retained_committed_size = 4 * 1024 * 1024;
+
+    /**
+     * @param arena_capacity     the capacity of the arenas
+     * @param max_pooled_arenas  the maximum number of released arenas that are kept for reuse
+     */
+    explicit ArenaPool(size_t arena_capacity, size_t max_pooled_arenas = 64);
+
+    /// @returns a pooled arena or a new arena if the pool is empty
+    [[nodiscard]] std::unique_ptr<Arena> Acquire();
+
+    /**
+     * Reset an arena and return it to the pool.
+     * The arena is destroyed instead if the pool is full.
+     */
+    void Release(std::unique_ptr<Arena> arena);
+
+    /// @returns the capacity of the arenas in this pool
+    [[nodiscard]] size_t GetArenaCapacity() const {
+      return m_arena_capacity;
+    }
+
+  private:
+    size_t m_arena_capacity;
+    size_t m_max_pooled_arenas;
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<Arena>> m_arenas;
+};
+
+/// @returns the global arena pool, which also provides the scratch arenas (@see #get_scratch_arena)
+ArenaPool& get_arena_pool();
+
+}  // namespace atom
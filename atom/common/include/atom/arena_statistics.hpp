@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atom/integer.hpp>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Arena statistics are opt-in (set ATOM_ARENA_STATISTICS in CMake, which defines this outside of Release builds).
+// Without it arenas carry no statistics state and the registry stays empty.
+//#define ATOM_ARENA_STATISTICS
+
+namespace atom {
+
+class Arena;
+
+/// Usage statistics of an {@link #Arena}
+struct ArenaStatistics {
+  /// The number of buckets in {@link #size_histogram}
+  static constexpr size_t k_histogram_bucket_count = 32;
+
+  size_t capacity{};                ///< the maximum number of bytes that can be allocated
+  size_t committed_size{};          ///< the number of bytes that are backed by committed memory
+  size_t used_size{};               ///< the number of bytes that are currently allocated (including alignment padding)
+  size_t peak_used_size{};          ///< the highest number of bytes that was allocated at once (the high-water mark)
+  u64 allocation_count{};           ///< the number of successful allocations
+  u64 failed_allocation_count{};    ///< the number of allocations that failed because the arena was exhausted
+  u64 reset_count{};                ///< the number of times the arena was reset
+
+  /**
+   * The number of allocations by size: bucket 0 counts empty allocations and bucket i > 0 counts
+   * allocations of [2^(i-1), 2^i) bytes. The last bucket also counts all larger allocations.
+   */
+  std::array<u64, k_histogram_bucket_count> size_histogram{};
+
+  /// @returns the histogram bucket for an allocation size
+  static size_t GetHistogramBucket(size_t number_of_bytes) {
+    return std::min<size_t>((size_t)std::bit_width(number_of_bytes), k_histogram_bucket_count - 1u);
+  }
+};
+
+/// The statistics of an arena in the registry (@see #get_arena_reports)
+struct ArenaReport {
+  std::string name;
+  ArenaStatistics statistics;
+};
+
+/**
+ * Take a snapshot of the statistics of all named arenas (@see Arena::Options::name).
+ * Arenas can be created, destroyed and used concurrently.
+ * @returns the reports in the order the arenas were created, or an empty list if statistics are compiled out.
+ */
+std::vector<ArenaReport> get_arena_reports();
+
+namespace detail {
+
+  /**
+   * The statistics counters that are embedded into an arena.
+   * The counters are only modified by the thread that owns the arena, but are atomic so that the registry
+   * can take snapshots from other threads. Relaxed loads and stores compile to plain memory accesses.
+   */
+  struct ArenaCounters {
+    std::atomic<size_t> committed_size{};
+    std::atomic<size_t> used_size{};
+    std::atomic<size_t> peak_used_size{};
+    std::atomic<u64> allocation_count{};
+    std::atomic<u64> failed_allocation_count{};
+    std::atomic<u64> reset_count{};
+    std::array<std::atomic<u64>, ArenaStatistics::k_histogram_bucket_count> size_histogram{};
+
+    void RecordAllocation(size_t number_of_bytes, size_t new_used_size) {
+      Increment(allocation_count);
+      Increment(size_histogram[ArenaStatistics::GetHistogramBucket(number_of_bytes)]);
+
+      used_size.store(new_used_size, std::memory_order_relaxed);
+      if(new_used_size > peak_used_size.load(std::memory_order_relaxed)) {
+        peak_used_size.store(new_used_size, std::memory_order_relaxed);
+      }
+    }
+
+    void RecordFailedAllocation() {
+      Increment(failed_allocation_count);
+    }
+
+    void RecordReset() {
+      Increment(reset_count);
+      used_size.store(0u, std::memory_order_relaxed);
+    }
+
+    void RecordUsedSize(size_t new_used_size) {
+      used_size.store(new_used_size, std::memory_order_relaxed);
+    }
+
+    void RecordCommittedSize(size_t new_committed_size) {
+      committed_size.store(new_committed_size, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] ArenaStatistics GetStatistics(size_t capacity) const {
+      ArenaStatistics statistics{};
+      statistics.capacity = capacity;
+      statistics.committed_size = committed_size.load(std::memory_order_relaxed);
+      statistics.used_size = used_size.load(std::memory_order_relaxed);
+      statistics.peak_used_size = peak_used_size.load(std::memory_order_relaxed);
+      statistics.allocation_count = allocation_count.load(std::memory_order_relaxed);
+      statistics.failed_allocation_count = failed_allocation_count.load(std::memory_order_relaxed);
+      statistics.reset_count = reset_count.load(std::memory_order_relaxed);
+      for(size_t i = 0; i < ArenaStatistics::k_histogram_bucket_count; i++) {
+        statistics.size_histogram[i] = size_histogram[i].load(std::memory_order_relaxed);
+      }
+      return statistics;
+    }
+
+    template<typename T>
+    static void Increment(std::atomic<T>& counter) {
+      counter.store(counter.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+    }
+  };
+
+  /// Add an arena to the registry under a name. The name is copied.
+  void register_arena(const Arena* arena, const char* name);
+
+  /// Remove an arena from the registry
+  void unregister_arena(const Arena* arena);
+
+} // namespace atom::detail
+
+}  // namespace atom
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <atom/arena.hpp>
+#include <atom/integer.hpp>
+#include <atom/non_copyable.hpp>
+#include <atom/panic.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace atom {
+
+/**
+ * A linear allocator that grows by chaining additional blocks, instead of failing once a fixed capacity is exhausted.
+ * Block sizes grow geometrically (up to {@link #k_max_block_size}), so only a logarithmic number of blocks is needed.
+ * Blocks are requested from an upstream memory resource.
+ *
+ * Like {@link #Arena}, individual allocations cannot be freed and destructors of objects are never run.
+ */
+class ChainedArena : public ArenaBase<ChainedArena>, NonCopyable {
+  private:
+    struct alignas(std::max_align_t) Block {
+      Block* next;
+      size_t size; ///< the size of the block including this header
+    };
+
+  public:
+    static constexpr size_t k_default_block_size = 64 * 1024;
+
+    /// Blocks do not grow beyond this size, unless a single allocation requires a larger block
+    static constexpr size_t k_max_block_size = 64 * 1024 * 1024;
+
+    /// A position in the arena, which allocations can be rolled back to (@see #GetMarker, #Rewind)
+    struct Marker {
+      Block* block;
+      u8* address;
+    };
+
+    /**
+     * @param initial_block_size the size of the first block
+     * @param upstream           the memory resource that provides the blocks, which must outlive the arena
+     */
+    explicit ChainedArena(
+      size_t initial_block_size = k_default_block_size,
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+    )   : m_upstream{upstream}
+        , m_next_block_size{std::max(initial_block_size, sizeof(Block) * 2u)} {
+    }
+
+   ~ChainedArena() {
+      FreeBlocks(m_first_block, nullptr);
+    }
+
+    /**
+     * Allocate a block of memory. A new block is chained if the current one is exhausted.
+     * @param number_of_bytes the size of the block
+     * @param alignment       the alignment of the block, which must be a power of two
+     * @returns a pointer to the block of memory (the upstream resource may throw if it is out of memory)
+     */
+    void* Allocate(size_t number_of_bytes, size_t alignment = alignof(std::max_align_t)) {
+      ATOM_ASSERT(alignment != 0u && (alignment & (alignment - 1u)) == 0u, "atom: alignment must be a power of two: {}", alignment)
+
+      const size_t padding = (size_t)(-(std::uintptr_t)m_current_address & (alignment - 1u));
+      const size_t available_bytes = (size_t)(m_block_end_address - m_current_address);
+
+      if(padding > available_bytes || number_of_bytes > available_bytes - padding) [[unlikely]] {
+        return AllocateSlow(number_of_bytes, alignment);
+      }
+
+      u8* address = m_current_address + padding;
+      m_current_address = address + number_of_bytes;
+      return address;
+    }
+
+    /**
+     * Free all allocations at once.
+     * The largest block is kept to serve future allocations and all other blocks are returned upstream.
+     */
+    void Reset() {
+      Block* largest_block = m_first_block;
+
+      for(Block* block = m_first_block; block != nullptr; block = block->next) {
+        if(block->size > largest_block->size) {
+          largest_block = block;
+        }
+      }
+
+      if(largest_block != nullptr) {
+        FreeBlocks(m_first_block, largest_block);
+        FreeBlocks(largest_block->next, nullptr);
+        largest_block->next = nullptr;
+      }
+
+      m_first_block = largest_block;
+      SetCurrentBlock(largest_block);
+    }
+
+    /// @returns a marker for the current position in the arena
+    [[nodiscard]] Marker GetMarker() const {
+      return {m_current_block, m_current_address};
+    }
+
+    /**
+     * Free all allocations that were made after a marker was taken.
+     * Blocks that are no longer used are kept for reuse. Markers must be rewound to in LIFO order (@see #ArenaScope).
+     * @param marker the marker
+     */
+    void Rewind(Marker marker) {
+      if(marker.block == nullptr) {
+        SetCurrentBlock(m_first_block);
+      } else {
+        m_current_block = marker.block;
+        m_current_address = marker.address;
+        m_block_end_address = (u8*)marker.block + marker.block->size;
+      }
+    }
+
+    /// @returns the total size of all blocks that are owned by the arena
+    [[nodiscard]] size_t GetReservedSize() const {
+      size_t size = 0u;
+      for(Block* block = m_first_block; block != nullptr; block = block->next) {
+        size += block->size;
+      }
+      return size;
+    }
+
+    /// @returns the number of blocks that are owned by the arena
+    [[nodiscard]] size_t GetBlockCount() const {
+      size_t count = 0u;
+      for(Block* block = m_first_block; block != nullptr; block = block->next) {
+        count++;
+      }
+      return count;
+    }
+
+  private:
+    static u8* GetBlockData(Block* block) {
+      return (u8*)block + sizeof(Block);
+    }
+
+    void SetCurrentBlock(Block* block) {
+      m_current_block = block;
+
+      if(block != nullptr) {
+        m_current_address = GetBlockData(block);
+        m_block_end_address = (u8*)block + block->size;
+      } else {
+        m_current_address = nullptr;
+        m_block_end_address = nullptr;
+      }
+    }
+
+    void* AllocateSlow(size_t number_of_bytes, size_t alignment) {
+      const size_t required_size = sizeof(Block) + std::max(alignment, alignof(Block)) - alignof(Block) + number_of_bytes;
+
+      if(required_size < number_of_bytes) {
+        ATOM_PANIC("atom: allocation size overflow: {}", number_of_bytes);
+      }
+
+      // Reuse the following blocks (which exist after a rewind) if they are large enough, or insert a new block.
+      Block* next_block = m_current_block != nullptr ? m_current_block->next : m_first_block;
+
+      while(next_block != nullptr && next_block->size < required_size) {
+        next_block = next_block->next;
+      }
+
+      if(next_block == nullptr) {
+        next_block = AllocateBlock(required_size);
+      }
+
+      SetCurrentBlock(next_block);
+      return Allocate(number_of_bytes, alignment);
+    }
+
+    Block* AllocateBlock(size_t required_size) {
+      const size_t size = std::max(m_next_block_size, required_size);
+
+      auto block = (Block*)m_upstream->allocate(size, alignof(Block));
+      block->size = size;
+
+      // Insert the block after the current block, so that unused blocks after it remain available for reuse.
+      if(m_current_block != nullptr) {
+        block->next = m_current_block->next;
+        m_current_block->next = block;
+      } else {
+        block->next = m_first_block;
+        m_first_block = block;
+      }
+
+      m_next_block_size = std::min(m_next_block_size * 2u, k_max_block_size);
+      return block;
+    }
+
+    void FreeBlocks(Block* first_block, Block* last_block) {
+      Block* block = first_block;
+
+      while(block != last_block) {
+        Block* next_block = block->next;
+        m_upstream->deallocate(block, block->size, alignof(Block));
+        block = next_block;
+      }
+    }
+
+    std::pmr::memory_resource* m_upstream;
+    size_t m_next_block_size;
+    Block* m_first_block{};
+    Block* m_current_block{};
+    u8* m_current_address{};
+    u8* m_block_end_address{};
+};
+
+}  // namespace atom
@@ -0,0 +1,53 @@
+#pragma once
+
+namespace atom {
+
+  /**
+   * An emergency function that is run when the program crashes, e.g. to write out buffered log messages.
+   * Crash hooks may run inside a signal handler, so they must be async-signal-safe:
+   * no heap allocation, no locks and only async-signal-safe system calls (such as write()).
+   */
+  typedef void (*CrashHookFn)(void* user_data);
+
+  /// The maximum number of crash hooks that can be registered at the same time
+  constexpr int k_max_crash_hooks = 32;
+
+  /**
+   * Register a crash hook, which is run by {@link #run_crash_hooks}.
+   * Hooks run in reverse order of registration, so that a hook may rely on hooks that were registered before it.
+   * @param hook      the crash hook
+   * @param user_data a pointer that is passed to the crash hook
+   * @returns a handle for {@link #unregister_crash_hook} or -1 if {@link #k_max_crash_hooks} hooks are registered already
+   */
+  int register_crash_hook(CrashHookFn hook, void* user_data);
+
+  /**
+   * Unregister a crash hook. The hook must not be unregistered concurrently with a crash.
+   * @param handle the handle returned by {@link #register_crash_hook}
+   */
+  void unregister_crash_hook(int handle);
+
+  /**
+   * Run all registered crash hooks. Only the first call has an effect.
+   * This is called by ATOM_PANIC and by the handlers of {@link #install_crash_handlers}.
+   */
+  void run_crash_hooks();
+
+  /**
+   * Install handlers for fatal signals (SIGSEGV, SIGABRT, SIGBUS, SIGILL and SIGFPE).
+   * The handlers write the signal and a backtrace to stderr (where supported), run the crash hooks
+   * and then re-raise the signal with its default action (e.g. to produce a core dump).
+   * The handlers run on an alternate signal stack to handle stack overflows. An alternate signal stack is
+   * a per-thread setting, so this only installs one for the calling thread.
+   * Other threads must call {@link #install_crash_signal_stack} for stack overflows on them to run the crash hooks.
+   */
+  void install_crash_handlers();
+
+  /**
+   * Give the calling thread an alternate signal stack, so that the crash handlers can run when its stack overflows.
+   * The stack is freed when the thread exits. Does nothing if the thread has an alternate signal stack already
+   * or if the platform does not support alternate signal stacks.
+   */
+  void install_crash_signal_stack();
+
+} // namespace atom
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__SANITIZE_ADDRESS__)
+  #define ATOM_ADDRESS_SANITIZER
+#elif defined(__has_feature)
+  #if __has_feature(address_sanitizer)
+    #define ATOM_ADDRESS_SANITIZER
+  #endif
+#endif
+
+#if defined(ATOM_ADDRESS_SANITIZER)
+  #include <sanitizer/asan_interface.h>
+#endif
+
+namespace atom::detail {
+
+  /**
+   * Mark a range of memory as inaccessible, so that AddressSanitizer reports any access to it.
+   * Does nothing when AddressSanitizer is not enabled.
+   */
+  inline void poison_memory(const void* address, size_t size) {
+#if defined(ATOM_ADDRESS_SANITIZER)
+    ASAN_POISON_MEMORY_REGION(address, size);
+#else
+    (void)address;
+    (void)size;
+#endif
+  }
+
+  /// Mark a range of memory that was poisoned by {@link #poison_memory} as accessible again.
+  inline void unpoison_memory(const void* address, size_t size) {
+#if defined(ATOM_ADDRESS_SANITIZER)
+    ASAN_UNPOISON_MEMORY_REGION(address, size);
+#else
+    (void)address;
+    (void)size;
+#endif
+  }
+
+} // namespace atom::detail
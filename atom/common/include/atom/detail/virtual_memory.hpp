@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <cstdint>
+
+#if defined(WIN32)
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+#else
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+  #include <sys/syscall.h>
+#endif
+
+namespace atom::detail {
+
+  /// The size of a (2 MiB) huge page
+  constexpr size_t k_huge_page_size = 2 * 1024 * 1024;
+
+  /// @returns the size of a virtual memory page (or the allocation granularity on Windows)
+  inline size_t get_page_size() {
+#if defined(WIN32)
+    SYSTEM_INFO system_info{};
+    GetSystemInfo(&system_info);
+    return (size_t)system_info.dwAllocationGranularity;
+#else
+    return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+  }
+
+  /**
+   * Reserve a range of virtual addresses without backing it with memory.
+   * Accessing the range faults until (parts of) it are committed with {@link #commit_virtual_memory}.
+   * @param size the size of the range, which must be a multiple of the page size
+   * @returns the start of the range or nullptr if the range could not be reserved
+   */
+  inline void* reserve_virtual_memory(size_t size) {
+#if defined(WIN32)
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void* address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return address != MAP_FAILED ? address : nullptr;
+#endif
+  }
+
+  /**
+   * Reserve a range of virtual addresses whose start is aligned to a multiple of the page size.
+   * @param size      the size of the range, which must be a multiple of the page size
+   * @param alignment the alignment, which must be a power-of-two multiple of the page size
+   * @returns the start of the range or nullptr if the range could not be reserved
+   */
+  inline void* reserve_aligned_virtual_memory(size_t size, size_t alignment) {
+#if defined(WIN32)
+    (void)alignment;
+    return reserve_virtual_memory(size);
+#else
+    // Over-reserve and unmap the unaligned head and tail of the range.
+    auto address = (u8*)reserve_virtual_memory(size + alignment);
+    if(address == nullptr) {
+      return nullptr;
+    }
+
+    const size_t head_size = (size_t)(-(std::uintptr_t)address & (alignment - 1u));
+    if(head_size != 0u) {
+      munmap(address, head_size);
+    }
+    munmap(address + head_size + size, alignment - head_size);
+    return address + head_size;
+#endif
+  }
+
+  /**
+   * Reserve a range of virtual addresses that is backed by explicit huge pages (MAP_HUGETLB on Linux).
+   * The huge pages for the whole range are reserved up front, so this fails if not enough huge pages are available.
+   * @param size the size of the range, which must be a multiple of {@link #k_huge_page_size}
+   * @returns the start of the range or nullptr if huge pages are unavailable
+   */
+  inline void* reserve_huge_page_virtual_memory(size_t size) {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    void* address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return address != MAP_FAILED ? address : nullptr;
+#else
+    (void)size;
+    return nullptr;
+#endif
+  }
+
+  /**
+   * Advise the operating system to back a range with transparent huge pages (MADV_HUGEPAGE on Linux).
+   * @returns whether the advice was accepted
+   */
+  inline bool advise_huge_pages(void* address, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+    (void)address;
+    (void)size;
+    return false;
+#endif
+  }
+
+  /**
+   * Bind the memory of a range to a NUMA node (mbind() with MPOL_BIND on Linux).
+   * The policy applies to pages that are faulted in after the call.
+   * @returns whether the range could be bound to the node
+   */
+  inline bool bind_to_numa_node(void* address, size_t size, int numa_node) {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int k_mpol_bind = 2;
+    constexpr size_t k_bits_per_word = sizeof(unsigned long) * 8u;
+
+    unsigned long node_mask[1024 / k_bits_per_word]{};
+
+    if(numa_node < 0 || (size_t)numa_node >= 1024u) {
+      return false;
+    }
+    node_mask[numa_node / k_bits_per_word] = 1ul << (numa_node % k_bits_per_word);
+
+    return syscall(SYS_mbind, address, size, k_mpol_bind, node_mask, 1024ul, 0u) == 0;
+#else
+    (void)address;
+    (void)size;
+    (void)numa_node;
+    return false;
+#endif
+  }
+
+  /// Fault in all pages of a committed range, so that later accesses do not incur page faults
+  inline void populate_virtual_memory(void* address, size_t size) {
+#if defined(__linux__) && defined(MADV_POPULATE_WRITE)
+    if(madvise(address, size, MADV_POPULATE_WRITE) == 0) {
+      return;
+    }
+#endif
+    // Fall back to touching each page. Freshly committed memory is zero, so writing zero preserves its contents.
+    const size_t page_size = get_page_size();
+
+    for(size_t offset = 0; offset < size; offset += page_size) {
+      ((volatile u8*)address)[offset] = 0u;
+    }
+  }
+
+  /**
+   * Make a page-aligned part of a reserved range readable and writable.
+   * Physical memory is only assigned once the pages are touched.
+   * @returns whether the memory could be committed
+   */
+  inline bool commit_virtual_memory(void* address, size_t size) {
+#if defined(WIN32)
+    return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return mprotect(address, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+  }
+
+  /**
+   * Return the physical memory of a committed, page-aligned part of a reserved range to the operating system.
+   * The range stays reserved, but must be committed again before it can be accessed.
+   */
+  inline void decommit_virtual_memory(void* address, size_t size) {
+#if defined(WIN32)
+    VirtualFree(address, size, MEM_DECOMMIT);
+#elif defined(__linux__)
+    madvise(address, size, MADV_DONTNEED);
+    mprotect(address, size, PROT_NONE);
+#else
+    // Replace the pages with a fresh reservation, since MADV_DONTNEED does not release memory immediately everywhere.
+    mmap(address, size, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+#endif
+  }
+
+  /// Release a range of virtual addresses that was reserved by {@link #reserve_virtual_memory}.
+  inline void release_virtual_memory(void* address, size_t size) {
+#if defined(WIN32)
+    (void)size;
+    VirtualFree(address, 0, MEM_RELEASE);
+#else
+    munmap(address, size);
+#endif
+  }
+
+} // namespace atom::detail
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <string_view>
 
 namespace atom {
 
@@ -12,4 +13,13 @@ inline void hash_combine(std::size_t& s, const T& v) {
   s ^= h(v) + 0x9e3779b9 + (s << 6) + (s >> 2);
 }
 
+/// Hash for std::string keys that allows looking up std::string_view keys without a conversion (use with std::equal_to<>)
+struct StringHash {
+  using is_transparent = void;
+
+  std::size_t operator()(std::string_view string) const {
+    return std::hash<std::string_view>{}(string);
+  }
+};
+
 } // namespace atom
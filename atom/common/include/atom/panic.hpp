@@ -12,8 +12,8 @@ namespace atom {
     [[noreturn]] void call_panic_handler(const char* file, int line, const char* message);
 
     template<typename... Args>
-    [[noreturn]] void panic(const char* file, int line, const char* format, Args&&... args) {
-      std::string message = fmt::format(fmt::runtime(format), std::forward<Args>(args)...);
+    [[noreturn]] void panic(const char* file, int line, fmt::format_string<Args...> format, Args&&... args) {
+      std::string message = fmt::format(format, std::forward<Args>(args)...);
 
       call_panic_handler(file, line, message.c_str());
     }
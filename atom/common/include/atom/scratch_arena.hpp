@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atom/arena.hpp>
+#include <initializer_list>
+
+namespace atom {
+
+/**
+ * A temporary allocation scope on one of the calling thread's scratch arenas (@see #get_scratch_arena).
+ * All allocations made through the scope are released when it is destroyed.
+ * A scratch arena must not be passed to or used from other threads.
+ */
+class ScratchArena : public ArenaScope<Arena> {
+  public:
+    using ArenaScope<Arena>::ArenaScope;
+
+    [[nodiscard]] Arena& Get() const {
+      return m_arena;
+    }
+
+    Arena* operator->() const {
+      return &m_arena;
+    }
+
+    Arena& operator*() const {
+      return m_arena;
+    }
+};
+
+/**
+ * Begin a temporary allocation scope on a thread-local scratch arena.
+ * Each thread owns two scratch arenas, which are taken from the global arena pool (@see #get_arena_pool)
+ * on first use and returned to it when the thread exits. Scopes on the same arena must end in LIFO order.
+ *
+ * A function that allocates its result from an arena passed in by the caller, which may itself be a scratch arena,
+ * passes that arena as a conflict, so that its temporaries do not end up in (and get rewound with) the result:
+ * `ScratchArena scratch = get_scratch_arena({&result_arena});`
+ *
+ * @param conflicts arenas which the scratch arena must not be (at most one)
+ * @returns the scope on a scratch arena that is not in the list of conflicts
+ */
+ScratchArena get_scratch_arena(std::initializer_list<const Arena*> conflicts = {});
+
+}  // namespace atom
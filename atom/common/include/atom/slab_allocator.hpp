@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <atom/arena.hpp>
+#include <atom/integer.hpp>
+#include <atom/non_copyable.hpp>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace atom {
+
+/// Statistics of a {@link #SlabAllocator} or {@link #ConcurrentSlabAllocator}
+struct SlabStatistics {
+  size_t slab_count;           ///< the number of slabs that were allocated from the arena
+  size_t block_count;          ///< the number of blocks that were carved out of the slabs
+  size_t free_block_count;     ///< the number of blocks on the shared free list (excluding thread caches)
+  size_t in_use_block_count;   ///< the number of blocks that are allocated (or held by thread caches)
+  size_t peak_in_use_block_count;
+  size_t batch_transfer_count; ///< the number of batches exchanged between thread caches and the depot
+};
+
+namespace detail {
+
+  /// A free block, which stores the link to the next free block in its own memory
+  struct SlabFreeBlock {
+    SlabFreeBlock* next;
+  };
+
+  /// Carves fixed-size blocks out of slabs, which are allocated from an arena
+  class SlabSource {
+    public:
+      SlabSource(Arena& arena, size_t block_size, size_t block_alignment, size_t slab_block_count);
+
+      /// @returns a new block or nullptr if the arena is exhausted
+      void* Carve() {
+        if(m_cursor == m_slab_end) [[unlikely]] {
+          if(!AllocateSlab()) {
+            return nullptr;
+          }
+        }
+        void* block = m_cursor;
+        m_cursor += m_block_size;
+        m_block_count++;
+        return block;
+      }
+
+      /// Forget the current slab, e.g. because the arena was reset. Counts the slabs and blocks from zero again.
+      void Reset() {
+        m_cursor = nullptr;
+        m_slab_end = nullptr;
+        m_slab_count = 0u;
+        m_block_count = 0u;
+      }
+
+      [[nodiscard]] size_t GetBlockSize() const {
+        return m_block_size;
+      }
+
+      [[nodiscard]] size_t GetSlabCount() const {
+        return m_slab_count;
+      }
+
+      [[nodiscard]] size_t GetBlockCount() const {
+        return m_block_count;
+      }
+
+    private:
+      bool AllocateSlab();
+
+      Arena& m_arena;
+      size_t m_block_size;
+      size_t m_block_alignment;
+      size_t m_slab_block_count;
+      u8* m_cursor{};
+      u8* m_slab_end{};
+      size_t m_slab_count{0};
+      size_t m_block_count{0};
+  };
+
+} // namespace atom::detail
+
+/**
+ * An allocator for fixed-size blocks with individual lifetimes, e.g. for nodes, messages or handles.
+ * Blocks are carved out of slabs that are allocated from an {@link #Arena}. Freed blocks are kept on an intrusive
+ * free list for reuse, so allocating and freeing is O(1). Blocks are never returned to the arena individually:
+ * call {@link #Reset} before the arena is reset or rewound past the slabs, otherwise the allocator hands out
+ * blocks that overlap new allocations from the arena.
+ * This allocator is not thread-safe (@see #ConcurrentSlabAllocator).
+ */
+class SlabAllocator : NonCopyable {
+  public:
+    /**
+     * @param arena            the arena that provides the slabs, which must outlive the allocator
+     * @param block_size       the size of the blocks
+     * @param block_alignment  the alignment of the blocks, which must be a power of two
+     * @param slab_block_count the number of blocks per slab
+     */
+    SlabAllocator(Arena& arena, size_t block_size, size_t block_alignment = alignof(std::max_align_t), size_t slab_block_count = 64)
+        : m_source{arena, block_size, block_alignment, slab_block_count} {
+    }
+
+    /// @returns a block or nullptr if the arena is exhausted
+    void* Allocate() {
+      void* block;
+
+      if(m_free_list != nullptr) {
+        block = m_free_list;
+        m_free_list = m_free_list->next;
+        m_free_block_count--;
+      } else {
+        block = m_source.Carve();
+        if(block == nullptr) {
+          return nullptr;
+        }
+      }
+
+      m_in_use_block_count++;
+      m_peak_in_use_block_count = std::max(m_peak_in_use_block_count, m_in_use_block_count);
+      return block;
+    }
+
+    /// Return a block that was allocated from this allocator
+    void Free(void* block) {
+      auto free_block = (detail::SlabFreeBlock*)block;
+      free_block->next = m_free_list;
+      m_free_list = free_block;
+      m_free_block_count++;
+      m_in_use_block_count--;
+    }
+
+    /// Forget all blocks and slabs. Call this when the arena is reset, after all blocks are no longer in use.
+    void Reset() {
+      m_source.Reset();
+      m_free_list = nullptr;
+      m_free_block_count = 0u;
+      m_in_use_block_count = 0u;
+    }
+
+    [[nodiscard]] SlabStatistics GetStatistics() const {
+      return {
+        m_source.GetSlabCount(), m_source.GetBlockCount(), m_free_block_count,
+        m_in_use_block_count, m_peak_in_use_block_count, 0u
+      };
+    }
+
+  private:
+    detail::SlabSource m_source;
+    detail::SlabFreeBlock* m_free_list{};
+    size_t m_free_block_count{0};
+    size_t m_in_use_block_count{0};
+    size_t m_peak_in_use_block_count{0};
+};
+
+/**
+ * A thread-safe allocator for fixed-size blocks (@see #SlabAllocator).
+ * Threads allocate from and free to a {@link #LocalCache} without synchronization. Caches exchange blocks in batches
+ * with a shared depot, which is protected by a mutex. Blocks may be freed to a different cache than the one that
+ * allocated them. {@link #Allocate} and {@link #Free} without a cache take the mutex for every call, but still
+ * exchange blocks with the depot in full batches. Call {@link #Reset} before the arena is reset (@see #SlabAllocator).
+ */
+class ConcurrentSlabAllocator : NonCopyable {
+  public:
+    /// A per-thread cache of free blocks
+    class LocalCache : NonCopyable {
+      public:
+        explicit LocalCache(ConcurrentSlabAllocator& allocator) : m_allocator{allocator} {}
+
+        /// Returns all cached blocks to the depot
+       ~LocalCache();
+
+        /// @returns a block or nullptr if the arena is exhausted
+        void* Allocate() {
+          if(m_free_list == nullptr && !m_allocator.RefillBatch(m_free_list, m_free_block_count)) [[unlikely]] {
+            return nullptr;
+          }
+
+          detail::SlabFreeBlock* block = m_free_list;
+          m_free_list = block->next;
+          m_free_block_count--;
+          return block;
+        }
+
+        /// Return a block that was allocated from the same allocator
+        void Free(void* block) {
+          auto free_block = (detail::SlabFreeBlock*)block;
+          free_block->next = m_free_list;
+          m_free_list = free_block;
+
+          if(++m_free_block_count >= m_allocator.m_batch_size * 2u) [[unlikely]] {
+            FlushBatch();
+          }
+        }
+
+        /// @returns the number of free blocks held by this cache
+        [[nodiscard]] size_t GetFreeBlockCount() const {
+          return m_free_block_count;
+        }
+
+      private:
+        void FlushBatch();
+
+        ConcurrentSlabAllocator& m_allocator;
+        detail::SlabFreeBlock* m_free_list{};
+        size_t m_free_block_count{0};
+    };
+
+    /**
+     * @param arena            the arena that provides the slabs, which must outlive the allocator
+     * @param block_size       the size of the blocks
+     * @param block_alignment  the alignment of the blocks, which must be a power of two
+     * @param batch_size       the number of blocks that are moved between a cache and the depot at once
+     */
+    ConcurrentSlabAllocator(Arena& arena, size_t block_size, size_t block_alignment = alignof(std::max_align_t), size_t batch_size = 32);
+
+    /// @returns a block or nullptr if the arena is exhausted
+    void* Allocate();
+
+    /// Return a block that was allocated from this allocator
+    void Free(void* block);
+
+    /**
+     * Forget all blocks and slabs. Call this when the arena is reset, after all blocks are no longer in use
+     * and all {@link #LocalCache}s have been destroyed.
+     */
+    void Reset();
+
+    [[nodiscard]] SlabStatistics GetStatistics() const;
+
+  private:
+    /// A list of free blocks in the depot
+    struct Batch {
+      detail::SlabFreeBlock* first_block;
+      size_t block_count;
+    };
+
+    bool RefillBatch(detail::SlabFreeBlock*& free_list, size_t& free_block_count);
+    void ReturnBatch(detail::SlabFreeBlock* free_list, size_t free_block_count);
+
+    size_t m_batch_size;
+    mutable std::mutex m_mutex;
+    detail::SlabSource m_source;
+    std::vector<Batch> m_depot;
+    Batch m_partial_batch{};      ///< collects the blocks freed without a cache until it holds a full batch
+    size_t m_depot_block_count{0}; ///< the number of blocks in the depot, including the partial batch
+    size_t m_peak_in_use_block_count{0};
+    size_t m_batch_transfer_count{0};
+};
+
+/**
+ * A pool of objects of a single type, backed by a {@link #SlabAllocator}.
+ * This pool is not thread-safe.
+ */
+template<typename T>
+class ObjectPool : NonCopyable {
+  public:
+    /**
+     * @param arena            the arena that provides the memory, which must outlive the pool
+     * @param slab_object_count the number of objects per slab
+     */
+    explicit ObjectPool(Arena& arena, size_t slab_object_count = 64)
+        : m_allocator{arena, sizeof(T), alignof(T), slab_object_count} {
+    }
+
+    /**
+     * Allocate and construct an object.
+     * @param args the arguments for the constructor
+     * @returns a pointer to the object or nullptr if the arena is exhausted
+     */
+    template<typename... Args>
+    T* New(Args&&... args) {
+      void* address = m_allocator.Allocate();
+      if(address == nullptr) {
+        return nullptr;
+      }
+      return new(address) T(std::forward<Args>(args)...);
+    }
+
+    /// Destroy an object and return its memory to the pool
+    void Delete(T* object) {
+      object->~T();
+      m_allocator.Free(object);
+    }
+
+    /// Forget all objects without destroying them (@see SlabAllocator::Reset)
+    void Reset() {
+      m_allocator.Reset();
+    }
+
+    [[nodiscard]] SlabStatistics GetStatistics() const {
+      return m_allocator.GetStatistics();
+    }
+
+  private:
+    SlabAllocator m_allocator;
+};
+
+}  // namespace atom
@@ -0,0 +1,45 @@
+#include <atom/arena_pool.hpp>
+
+namespace atom {
+
+ArenaPool::ArenaPool(size_t arena_capacity, size_t max_pooled_arenas)
+    : m_arena_capacity{arena_capacity}
+    , m_max_pooled_arenas{max_pooled_arenas} {
+}
+
+std::unique_ptr<Arena> ArenaPool::Acquire() {
+  {
+    std::lock_guard lock{m_mutex};
+
+    if(!m_arenas.empty()) {
+      std::unique_ptr<Arena> arena = std::move(m_arenas.back());
+      m_arenas.pop_back();
+      return arena;
+    }
+  }
+
+  return std::make_unique<Arena>(m_arena_capacity);
+}
+
+void ArenaPool::Release(std::unique_ptr<Arena> arena) {
+  if(!arena) {
+    return;
+  }
+
+  arena->Reset(arena->GetCommittedSize() > k_max_retained_committed_size);
+
+  std::lock_guard lock{m_mutex};
+
+  if(m_arenas.size() < m_max_pooled_arenas) {
+    m_arenas.push_back(std::move(arena));
+  }
+}
+
+ArenaPool& get_arena_pool() {
+  // Arenas only reserve address space up front, so they can be sized generously.
+  // Intentionally leaked, so that threads which exit after static destruction can still return their scratch arenas.
+  static ArenaPool* pool = new ArenaPool{256 * 1024 * 1024};
+  return *pool;
+}
+
+}  // namespace atom
@@ -0,0 +1,68 @@
+#include <atom/arena.hpp>
+#include <atom/arena_statistics.hpp>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace atom {
+
+namespace {
+
+struct RegisteredArena {
+  const Arena* arena;
+  std::string name;
+};
+
+struct ArenaRegistry {
+  std::mutex mutex;
+  std::vector<RegisteredArena> arenas;
+};
+
+ArenaRegistry& get_arena_registry() {
+  // Intentionally leaked, so that arenas with static storage duration can unregister during exit.
+  static ArenaRegistry* registry = new ArenaRegistry{};
+  return *registry;
+}
+
+}  // anonymous namespace
+
+std::vector<ArenaReport> get_arena_reports() {
+  std::vector<ArenaReport> reports{};
+
+#if defined(ATOM_ARENA_STATISTICS)
+  ArenaRegistry& registry = get_arena_registry();
+  std::lock_guard lock{registry.mutex};
+
+  reports.reserve(registry.arenas.size());
+  for(const auto& [arena, name] : registry.arenas) {
+    reports.push_back({name, arena->GetStatistics()});
+  }
+#endif
+
+  return reports;
+}
+
+namespace detail {
+
+  void register_arena(const Arena* arena, const char* name) {
+    ArenaRegistry& registry = get_arena_registry();
+    std::lock_guard lock{registry.mutex};
+    registry.arenas.push_back({arena, name});
+  }
+
+  void unregister_arena(const Arena* arena) {
+    ArenaRegistry& registry = get_arena_registry();
+    std::lock_guard lock{registry.mutex};
+
+    const auto match = std::find_if(registry.arenas.begin(), registry.arenas.end(), [&](RegisteredArena const& entry) {
+      return entry.arena == arena;
+    });
+    if(match != registry.arenas.end()) {
+      registry.arenas.erase(match);
+    }
+  }
+
+} // namespace atom::detail
+
+}  // namespace atom
@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <atom/crash.hpp>
+#include <atomic>
+#include <csignal>
+#include <cstring>
+#include <memory>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <unistd.h>
+  #define ATOM_CRASH_USE_SIGACTION
+#endif
+
+#if defined(ATOM_CRASH_USE_SIGACTION) && __has_include(<execinfo.h>)
+  #include <execinfo.h>
+  #define ATOM_CRASH_USE_BACKTRACE
+#endif
+
+namespace atom {
+
+  namespace {
+
+    struct CrashHook {
+      std::atomic_bool in_use{false};
+      std::atomic<CrashHookFn> hook{nullptr};
+      std::atomic<void*> user_data{nullptr};
+      std::atomic<unsigned long long> sequence{0};
+    };
+
+    CrashHook g_crash_hooks[k_max_crash_hooks];
+    std::atomic<unsigned long long> g_crash_hook_sequence{0};
+    std::atomic_flag g_crash_hooks_ran{};
+
+  } // anonymous namespace
+
+  int register_crash_hook(CrashHookFn hook, void* user_data) {
+    for(int i = 0; i < k_max_crash_hooks; i++) {
+      CrashHook& crash_hook = g_crash_hooks[i];
+
+      bool in_use = false;
+
+      if(crash_hook.in_use.compare_exchange_strong(in_use, true)) {
+        crash_hook.user_data.store(user_data);
+        crash_hook.sequence.store(++g_crash_hook_sequence);
+        crash_hook.hook.store(hook);
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void unregister_crash_hook(int handle) {
+    if(handle >= 0 && handle < k_max_crash_hooks) {
+      g_crash_hooks[handle].hook.store(nullptr);
+      g_crash_hooks[handle].in_use.store(false);
+    }
+  }
+
+  void run_crash_hooks() {
+    if(g_crash_hooks_ran.test_and_set()) {
+      return;
+    }
+
+    // Run the hooks from the most recently to the least recently registered one.
+    unsigned long long previous_sequence = ~0ull;
+
+    while(true) {
+      int next_hook = -1;
+      unsigned long long next_sequence = 0;
+
+      for(int i = 0; i < k_max_crash_hooks; i++) {
+        const unsigned long long sequence = g_crash_hooks[i].sequence.load();
+
+        if(g_crash_hooks[i].hook.load() != nullptr && sequence < previous_sequence && sequence > next_sequence) {
+          next_hook = i;
+          next_sequence = sequence;
+        }
+      }
+
+      if(next_hook == -1) {
+        break;
+      }
+
+      const CrashHookFn hook = g_crash_hooks[next_hook].hook.load();
+      if(hook != nullptr) {
+        hook(g_crash_hooks[next_hook].user_data.load());
+      }
+      previous_sequence = next_sequence;
+    }
+  }
+
+#if defined(ATOM_CRASH_USE_SIGACTION)
+
+  namespace {
+
+    constexpr int k_fatal_signals[] {SIGSEGV, SIGABRT, SIGBUS, SIGILL, SIGFPE};
+
+    constexpr size_t k_signal_stack_size = 64 * 1024;
+    constexpr int k_max_backtrace_depth = 64;
+
+    alignas(16) char g_signal_stack[k_signal_stack_size]; ///< the alternate signal stack of the thread that installed the handlers
+    char g_message_buffer[256]; ///< preallocated, because the heap may be corrupted when a signal is raised
+
+    const char* get_signal_name(int signal) {
+      switch(signal) {
+        case SIGSEGV: return "SIGSEGV";
+        case SIGABRT: return "SIGABRT";
+        case SIGBUS:  return "SIGBUS";
+        case SIGILL:  return "SIGILL";
+        case SIGFPE:  return "SIGFPE";
+        default: return "unknown signal";
+      }
+    }
+
+    void write_to_stderr(const char* data, size_t length) {
+      while(length > 0u) {
+        const ssize_t result = ::write(STDERR_FILENO, data, length);
+        if(result <= 0) {
+          return;
+        }
+        data += result;
+        length -= (size_t)result;
+      }
+    }
+
+    void handle_fatal_signal(int signal) {
+      // snprintf() is not async-signal-safe, so build the message by hand.
+      const char* signal_name = get_signal_name(signal);
+      size_t length = 0;
+
+      const auto append = [&](const char* string) {
+        const size_t string_length = std::min(std::strlen(string), sizeof(g_message_buffer) - length);
+        std::memcpy(&g_message_buffer[length], string, string_length);
+        length += string_length;
+      };
+
+      append("fatal signal: ");
+      append(signal_name);
+      append("\n");
+      write_to_stderr(g_message_buffer, length);
+
+#if defined(ATOM_CRASH_USE_BACKTRACE)
+      void* frames[k_max_backtrace_depth];
+      const int frame_count = ::backtrace(frames, k_max_backtrace_depth);
+      ::backtrace_symbols_fd(frames, frame_count, STDERR_FILENO);
+#endif
+
+      run_crash_hooks();
+
+      // The handler has been reset to the default action (SA_RESETHAND).
+      // The signal is blocked while the handler runs, so it is delivered once the handler returns.
+      std::raise(signal);
+    }
+
+    /// @returns whether the calling thread has an alternate signal stack already (e.g. installed by a sanitizer)
+    bool has_signal_stack() {
+      stack_t signal_stack{};
+      return ::sigaltstack(nullptr, &signal_stack) == 0 && (signal_stack.ss_flags & SS_DISABLE) == 0;
+    }
+
+    void set_signal_stack(char* memory) {
+      stack_t signal_stack{};
+      signal_stack.ss_sp = memory;
+      signal_stack.ss_size = k_signal_stack_size;
+      signal_stack.ss_flags = 0;
+      ::sigaltstack(&signal_stack, nullptr);
+    }
+
+    /// Owns the alternate signal stack of a thread and disables it before the memory is freed on thread exit.
+    struct ThreadSignalStack {
+      std::unique_ptr<char[]> memory;
+
+     ~ThreadSignalStack() {
+        if(memory) {
+          stack_t signal_stack{};
+          signal_stack.ss_flags = SS_DISABLE;
+          ::sigaltstack(&signal_stack, nullptr);
+        }
+      }
+    };
+
+    thread_local ThreadSignalStack t_signal_stack;
+
+  } // anonymous namespace
+
+  void install_crash_signal_stack() {
+    if(has_signal_stack()) {
+      return;
+    }
+    t_signal_stack.memory = std::make_unique<char[]>(k_signal_stack_size);
+    set_signal_stack(t_signal_stack.memory.get());
+  }
+
+  void install_crash_handlers() {
+#if defined(ATOM_CRASH_USE_BACKTRACE)
+    // The first call to backtrace() may load libgcc and allocate memory, which is not safe inside a signal handler.
+    void* frame;
+    ::backtrace(&frame, 1);
+#endif
+
+    if(!has_signal_stack()) {
+      set_signal_stack(g_signal_stack);
+    }
+
+    struct sigaction action{};
+    action.sa_handler = &handle_fatal_signal;
+    action.sa_flags = SA_ONSTACK | SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+
+    for(const int signal : k_fatal_signals) {
+      ::sigaction(signal, &action, nullptr);
+    }
+  }
+
+#else
+
+  namespace {
+
+    void handle_fatal_signal(int signal) {
+      run_crash_hooks();
+
+      std::signal(signal, SIG_DFL);
+      std::raise(signal);
+    }
+
+  } // anonymous namespace
+
+  void install_crash_signal_stack() {
+  }
+
+  void install_crash_handlers() {
+    for(const int signal : {SIGSEGV, SIGABRT, SIGILL, SIGFPE}) {
+      std::signal(signal, &handle_fatal_signal);
+    }
+  }
+
+#endif
+
+} // namespace atom
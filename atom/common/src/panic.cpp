@@ -1,4 +1,5 @@
 
+#include <atom/crash.hpp>
 #include <atom/panic.hpp>
 #include <cstdlib>
 #include <fmt/color.h>
@@ -15,6 +16,7 @@ namespace atom {
 
     [[noreturn]] void call_panic_handler(const char* file, int line, const char* message) {
       g_panic_handler_fn(file, line, message);
+      run_crash_hooks();
       std::exit(-1);
     }
 
@@ -0,0 +1,40 @@
+#include <atom/arena_pool.hpp>
+#include <atom/panic.hpp>
+#include <atom/scratch_arena.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace atom {
+
+namespace {
+
+  struct ScratchArenas {
+    std::array<std::unique_ptr<Arena>, 2> arenas;
+
+   ~ScratchArenas() {
+      for(auto& arena : arenas) {
+        get_arena_pool().Release(std::move(arena));
+      }
+    }
+  };
+
+  thread_local ScratchArenas g_scratch_arenas;
+
+}  // anonymous namespace
+
+ScratchArena get_scratch_arena(std::initializer_list<const Arena*> conflicts) {
+  for(auto& arena : g_scratch_arenas.arenas) {
+    if(!arena) {
+      arena = get_arena_pool().Acquire();
+    }
+
+    if(std::find(conflicts.begin(), conflicts.end(), arena.get()) == conflicts.end()) {
+      return ScratchArena{*arena};
+    }
+  }
+
+  ATOM_PANIC("atom: all scratch arenas conflict with the arenas in use by the caller");
+}
+
+}  // namespace atom
@@ -0,0 +1,169 @@
+#include <atom/panic.hpp>
+#include <atom/slab_allocator.hpp>
+#include <algorithm>
+
+namespace atom {
+
+namespace detail {
+
+  SlabSource::SlabSource(Arena& arena, size_t block_size, size_t block_alignment, size_t slab_block_count)
+      : m_arena{arena}
+      , m_block_alignment{std::max(block_alignment, alignof(SlabFreeBlock))}
+      , m_slab_block_count{std::max<size_t>(slab_block_count, 1u)} {
+    ATOM_ASSERT((block_alignment & (block_alignment - 1u)) == 0u, "atom: alignment must be a power of two: {}", block_alignment)
+
+    // Each block must be able to hold the free list link and be aligned when placed back-to-back.
+    m_block_size = std::max(block_size, sizeof(SlabFreeBlock));
+    m_block_size = (m_block_size + m_block_alignment - 1u) & ~(m_block_alignment - 1u);
+  }
+
+  bool SlabSource::AllocateSlab() {
+    auto slab = (u8*)m_arena.Allocate(m_block_size * m_slab_block_count, m_block_alignment);
+
+    if(slab == nullptr) {
+      return false;
+    }
+
+    m_cursor = slab;
+    m_slab_end = slab + m_block_size * m_slab_block_count;
+    m_slab_count++;
+    return true;
+  }
+
+} // namespace atom::detail
+
+ConcurrentSlabAllocator::LocalCache::~LocalCache() {
+  if(m_free_list != nullptr) {
+    m_allocator.ReturnBatch(m_free_list, m_free_block_count);
+  }
+}
+
+void ConcurrentSlabAllocator::LocalCache::FlushBatch() {
+  // Keep one batch for future allocations and return the rest.
+  detail::SlabFreeBlock* last_kept_block = m_free_list;
+  for(size_t i = 1; i < m_allocator.m_batch_size; i++) {
+    last_kept_block = last_kept_block->next;
+  }
+
+  m_allocator.ReturnBatch(last_kept_block->next, m_free_block_count - m_allocator.m_batch_size);
+  last_kept_block->next = nullptr;
+  m_free_block_count = m_allocator.m_batch_size;
+}
+
+ConcurrentSlabAllocator::ConcurrentSlabAllocator(Arena& arena, size_t block_size, size_t block_alignment, size_t batch_size)
+    : m_batch_size{std::max<size_t>(batch_size, 1u)}
+    , m_source{arena, block_size, block_alignment, m_batch_size * 4u} {
+  // Avoid growing the depot (and allocating) while the mutex is held in the common case.
+  m_depot.reserve(64);
+}
+
+void* ConcurrentSlabAllocator::Allocate() {
+  std::lock_guard lock{m_mutex};
+
+  // Allocate from the partial batch, so that the full batches stay intact for the caches.
+  if(m_partial_batch.block_count == 0u && !m_depot.empty()) {
+    m_partial_batch = m_depot.back();
+    m_depot.pop_back();
+  }
+
+  if(m_partial_batch.block_count != 0u) {
+    detail::SlabFreeBlock* block = m_partial_batch.first_block;
+
+    m_partial_batch.first_block = block->next;
+    m_partial_batch.block_count--;
+    m_depot_block_count--;
+    return block;
+  }
+
+  void* block = m_source.Carve();
+  if(block != nullptr) {
+    m_peak_in_use_block_count = std::max(m_peak_in_use_block_count, m_source.GetBlockCount() - m_depot_block_count);
+  }
+  return block;
+}
+
+void ConcurrentSlabAllocator::Free(void* block) {
+  auto free_block = (detail::SlabFreeBlock*)block;
+
+  std::lock_guard lock{m_mutex};
+
+  free_block->next = m_partial_batch.first_block;
+  m_partial_batch.first_block = free_block;
+  m_depot_block_count++;
+
+  if(++m_partial_batch.block_count == m_batch_size) {
+    m_depot.push_back(m_partial_batch);
+    m_partial_batch = {};
+  }
+}
+
+void ConcurrentSlabAllocator::Reset() {
+  std::lock_guard lock{m_mutex};
+
+  m_source.Reset();
+  m_depot.clear();
+  m_partial_batch = {};
+  m_depot_block_count = 0u;
+}
+
+SlabStatistics ConcurrentSlabAllocator::GetStatistics() const {
+  std::lock_guard lock{m_mutex};
+
+  return {
+    m_source.GetSlabCount(), m_source.GetBlockCount(), m_depot_block_count,
+    m_source.GetBlockCount() - m_depot_block_count, m_peak_in_use_block_count, m_batch_transfer_count
+  };
+}
+
+bool ConcurrentSlabAllocator::RefillBatch(detail::SlabFreeBlock*& free_list, size_t& free_block_count) {
+  std::lock_guard lock{m_mutex};
+
+  m_batch_transfer_count++;
+
+  if(!m_depot.empty()) {
+    const Batch batch = m_depot.back();
+    m_depot.pop_back();
+    m_depot_block_count -= batch.block_count;
+
+    free_list = batch.first_block;
+    free_block_count = batch.block_count;
+    return true;
+  }
+
+  // Top up the partial batch with blocks carved out of the slabs.
+  detail::SlabFreeBlock* first_block = m_partial_batch.first_block;
+  size_t block_count = m_partial_batch.block_count;
+
+  m_depot_block_count -= block_count;
+  m_partial_batch = {};
+
+  while(block_count < m_batch_size) {
+    auto block = (detail::SlabFreeBlock*)m_source.Carve();
+    if(block == nullptr) {
+      break;
+    }
+    block->next = first_block;
+    first_block = block;
+    block_count++;
+  }
+
+  if(block_count == 0u) {
+    return false;
+  }
+
+  m_peak_in_use_block_count = std::max(m_peak_in_use_block_count, m_source.GetBlockCount() - m_depot_block_count);
+
+  free_list = first_block;
+  free_block_count = block_count;
+  return true;
+}
+
+void ConcurrentSlabAllocator::ReturnBatch(detail::SlabFreeBlock* free_list, size_t free_block_count) {
+  std::lock_guard lock{m_mutex};
+
+  m_depot.push_back({free_list, free_block_count});
+  m_depot_block_count += free_block_count;
+  m_batch_transfer_count++;
+}
+
+}  // namespace atom
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atom/arena_statistics.hpp>
+#include <atom/logger/logger.hpp>
+#include <iterator>
+#include <string>
+
+namespace atom {
+
+  /**
+   * Log the statistics of all named arenas (@see #get_arena_reports), one message per arena.
+   * Arenas that still hold allocations show up with a non-zero `used` field, which makes the report useful
+   * for finding scopes that never rewind their arena when it is logged at shutdown.
+   * Arenas that ran out of memory or came within 10% of their capacity are additionally logged as warnings.
+   * Logs nothing unless ATOM_ARENA_STATISTICS is defined.
+   * @tparam level the log level of the report
+   * @param logger the logger to write the report to
+   */
+  template<Level level = Info>
+  void log_arena_report(Logger const& logger = get_logger()) {
+    for(const auto& [name, statistics] : get_arena_reports()) {
+      // Only list the non-empty buckets of the size histogram, e.g. "[16, 32): 120"
+      std::string histogram{};
+
+      for(size_t i = 0; i < ArenaStatistics::k_histogram_bucket_count; i++) {
+        const u64 count = statistics.size_histogram[i];
+
+        if(count != 0u) {
+          const char* separator = histogram.empty() ? "" : ", ";
+
+          if(i == 0u) {
+            fmt::format_to(std::back_inserter(histogram), "{}0: {}", separator, count);
+          } else if(i == ArenaStatistics::k_histogram_bucket_count - 1u) {
+            fmt::format_to(std::back_inserter(histogram), "{}[{}, inf): {}", separator, u64{1} << (i - 1u), count);
+          } else {
+            fmt::format_to(std::back_inserter(histogram), "{}[{}, {}): {}", separator, u64{1} << (i - 1u), u64{1} << i, count);
+          }
+        }
+      }
+
+      logger.Log<level>({
+        {"arena", name},
+        {"used", statistics.used_size},
+        {"peak", statistics.peak_used_size},
+        {"committed", statistics.committed_size},
+        {"capacity", statistics.capacity},
+        {"allocations", statistics.allocation_count},
+        {"failed", statistics.failed_allocation_count},
+        {"resets", statistics.reset_count}
+      }, "arena '{}': peak {} of {} bytes, allocation sizes {{{}}}", name, statistics.peak_used_size, statistics.capacity, histogram);
+
+      if(statistics.failed_allocation_count != 0u) {
+        logger.Log<Warn>("arena '{}': {} allocations failed because the arena was exhausted", name, statistics.failed_allocation_count);
+      } else if(statistics.peak_used_size > statistics.capacity - statistics.capacity / 10u) {
+        logger.Log<Warn>("arena '{}': peak usage is within 10% of the capacity", name);
+      }
+    }
+  }
+
+} // namespace atom
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/logger/logger.hpp>
+#include <atom/non_copyable.hpp>
+#include <array>
+#include <cstdio>
+#include <fmt/format.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace atom {
+
+  /**
+   * Definitions of the binary log format written by {@link #LoggerBinarySink}.
+   *
+   * A binary log starts with a signature ("ATOMLOG" followed by the format version) and is followed by a sequence of records.
+   * Each record starts with its {@link #RecordType}. Component names and format strings are written once
+   * in a definition record and are referenced by their ID afterwards. The arguments of a message are stored
+   * in a packed argument buffer (@see #PackedArgumentType). All values are stored in the byte order of the host
+   * that wrote the log.
+   */
+  namespace binary_log {
+
+    inline constexpr std::array<char, 7> k_signature{'A', 'T', 'O', 'M', 'L', 'O', 'G'};
+    inline constexpr u8 k_version = 1;
+
+    /// Component ID of messages that do not have a component
+    inline constexpr u16 k_no_component = 0xFFFF;
+
+    /// Maximum length of a format string and maximum size of the packed arguments of a message. Longer message texts are truncated.
+    inline constexpr u32 k_max_record_data_size = 64 * 1024 * 1024;
+
+    /// Components and formats are assigned consecutive IDs starting at zero, in the order they are defined.
+    enum class RecordType : u8 {
+      DefineComponent = 1, ///< u16 component ID, u16 length, characters
+      DefineFormat    = 2, ///< u32 format ID, u32 length, characters
+      Message         = 3  ///< u8 level, u8 hour, u8 minute, u8 second, u32 microsecond, u16 component ID, u32 format ID, u32 arguments size, packed arguments
+    };
+
+  } // namespace atom::binary_log
+
+  /// Reads messages from a binary log (@see #binary_log)
+  class BinaryLogReader : NonCopyable {
+    public:
+      enum class Status {
+        Ok,
+        EndOfFile,
+        Malformed
+      };
+
+      /**
+       * Create a reader for a binary log
+       * @param file the file to read from, which must remain open while the reader is used
+       */
+      explicit BinaryLogReader(std::FILE* file) : file{file} {}
+
+      /**
+       * Read the next message from the binary log.
+       * @param message receives the message, which is valid until the next call
+       * @returns Ok if a message was read, EndOfFile at the end of the log and Malformed if the log is not a valid binary log
+       */
+      Status Next(Logger::Message& message);
+
+    private:
+      template<typename T>
+      bool Read(T& value);
+      bool ReadString(std::string& string, size_t length);
+
+      std::FILE* file;
+      bool read_signature{false};
+      std::vector<std::optional<std::string>> components{};
+      std::vector<std::string> formats{};
+      std::vector<u8> arguments{};
+      fmt::memory_buffer text{};
+  };
+
+} // namespace atom
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/non_copyable.hpp>
+
+namespace atom::detail {
+
+  /*
+   * Epoch-based reclamation of data structures that are shared between lock-free readers and writers.
+   *
+   * Readers wrap accesses to shared data in an EpochReadSection. A writer that unpublished a data structure
+   * calls advance_epoch() and may free the data structure once is_epoch_quiescent() returns true
+   * for the returned epoch. At that point no reader can still be accessing it.
+   */
+
+  /// Mark the calling thread as reading shared data. Calls may be nested.
+  void enter_epoch();
+
+  /// Mark the end of the innermost {@link #enter_epoch} call of the calling thread.
+  void leave_epoch();
+
+  /**
+   * Advance the global epoch. Must be called after unpublishing a data structure.
+   * @returns the epoch that readers of the unpublished data structure may still be in
+   */
+  u64 advance_epoch();
+
+  /// @returns whether no reader is in the given (or an earlier) epoch anymore
+  bool is_epoch_quiescent(u64 epoch);
+
+  /// @returns whether the calling thread is currently reading shared data
+  bool is_in_epoch();
+
+  /// RAII wrapper for {@link #enter_epoch} and {@link #leave_epoch}
+  class EpochReadSection : NonCopyable {
+    public:
+      EpochReadSection() {
+        enter_epoch();
+      }
+
+     ~EpochReadSection() {
+        leave_epoch();
+      }
+  };
+
+} // namespace atom::detail
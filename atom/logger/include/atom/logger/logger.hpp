@@ -2,12 +2,20 @@
 #pragma once
 
 #include <algorithm>
-#include <ctime>
+#include <array>
+#include <atom/logger/detail/epoch.hpp>
+#include <atom/logger/packed_arguments.hpp>
+#include <atomic>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string_view>
 #include <fmt/format.h>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 namespace atom {
@@ -64,6 +72,65 @@ namespace atom {
       int runtime_log_mask = All; ///< bitset of currently enabled log levels
   };
 
+  namespace detail {
+
+    inline std::atomic<int> global_log_mask{All};
+
+    /// The type returned by fmt::runtime() (which differs between {fmt} versions)
+    using RuntimeFormatString = decltype(fmt::runtime(fmt::string_view{}));
+
+    fmt::memory_buffer* acquire_staging_buffer();
+    void release_staging_buffer(fmt::memory_buffer* buffer);
+
+    /**
+     * A per-thread buffer for formatting log messages, which is reused between messages to avoid heap allocations.
+     * Messages that are logged while another message is being formatted or delivered (e.g. from within a sink)
+     * use separate buffers.
+     */
+    class StagingBuffer {
+      public:
+        StagingBuffer() : buffer{acquire_staging_buffer()} {}
+       ~StagingBuffer() { release_staging_buffer(buffer); }
+
+        StagingBuffer(StagingBuffer const&) = delete;
+        StagingBuffer& operator=(StagingBuffer const&) = delete;
+
+        /// @returns the (empty) buffer
+        fmt::memory_buffer& Get() {
+          return *buffer;
+        }
+
+      private:
+        fmt::memory_buffer* buffer;
+    };
+
+  } // namespace atom::detail
+
+  /**
+   * Sets the bitset of log {@link #Level}s that are enabled globally, for all loggers.
+   * A level that is disabled globally is discarded by the logging macros with a single relaxed load and branch,
+   * before any of the message arguments are evaluated.
+   */
+  inline void set_global_log_mask(int mask) {
+    detail::global_log_mask.store(mask, std::memory_order_relaxed);
+  }
+
+  /// @returns the bitset of log {@link #Level}s that are enabled globally
+  inline int get_global_log_mask() {
+    return detail::global_log_mask.load(std::memory_order_relaxed);
+  }
+
+  /// @returns whether the specified log {@link #Level} is enabled globally
+  inline bool is_log_level_enabled_globally(Level level) {
+    return detail::global_log_mask.load(std::memory_order_relaxed) & static_cast<int>(level);
+  }
+
+  /**
+   * Log the number of messages that rate limited and sampled call sites (@see rate_limit.hpp) suppressed
+   * since they last reported, to the default logger. Called by {@link #Logger::Flush} and at exit.
+   */
+  void report_suppressed_messages();
+
   /**
    * A named or unnamed logger.
    * Allows logging formatted messages to one or multiple logging sinks (@see #SinkBase) (e.g. console or file sink).
@@ -72,7 +139,51 @@ namespace atom {
    */
   class Logger : public RuntimeLogLevelList {
     public:
-      /// A structured log message containing log level, time, source component and message text.
+      /// The bitset of log {@link #Level}s that are compiled in. Messages of other levels are discarded at compile time.
+#if defined(NDEBUG)
+      static constexpr int k_build_log_mask = Info | Warn | Error | Fatal;
+#else
+      static constexpr int k_build_log_mask = All;
+#endif
+
+      /**
+       * A typed key/value pair that is attached to a log message (@see #Log).
+       * Fields reference their key and string values without copying them.
+       */
+      struct Field {
+        using Value = std::variant<bool, s64, u64, double, std::string_view>;
+
+        Field() = default;
+
+        /**
+         * @param key   the name of the field
+         * @param value a boolean, integer, floating-point or string value
+         */
+        template<typename T>
+          requires std::is_arithmetic_v<T> || std::is_convertible_v<T const&, std::string_view>
+        Field(std::string_view key, T const& value) : key{key}, value{ToValue(value)} {}
+
+        std::string_view key;
+        Value value;
+
+        private:
+          template<typename T>
+          static Value ToValue(T const& value) {
+            if constexpr(std::is_same_v<T, bool>) {
+              return value;
+            } else if constexpr(std::is_integral_v<T> && std::is_signed_v<T>) {
+              return (s64)value;
+            } else if constexpr(std::is_integral_v<T>) {
+              return (u64)value;
+            } else if constexpr(std::is_floating_point_v<T>) {
+              return (double)value;
+            } else {
+              return std::string_view{value};
+            }
+          }
+      };
+
+      /// A structured log message containing log level, time, source component, message text and optional fields.
       struct Message {
         Level level;
 
@@ -80,13 +191,40 @@ namespace atom {
           int hour;
           int minute;
           int second;
+          int microsecond;
         } time;
 
         std::optional<std::string_view> component;
 
         std::string_view text;
+
+        std::span<const Field> fields{};
+      };
+
+      /**
+       * A structured log message whose text has not been formatted yet.
+       * Instead it carries the format string and the arguments in a packed argument buffer
+       * (@see #PackedArgumentType), so that formatting can happen at a later point or on a different thread.
+       */
+      struct DeferredMessage {
+        Level level;
+        Message::Time time;
+        std::optional<std::string_view> component;
+
+        std::string_view format; ///< the format string, which must have static storage duration
+        std::span<const u8> arguments;
+
+        /// Append the formatted message text to a buffer
+        void FormatTo(fmt::memory_buffer& buffer) const {
+          if(!detail::format_packed_arguments(buffer, format, arguments)) {
+            buffer.append(std::string_view{"(malformed packed arguments)"});
+          }
+        }
       };
 
+      /// The maximum number of bytes that {@link #LogDeferred} will store in a packed argument buffer
+      static constexpr size_t k_max_packed_arguments_size = 256;
+
       /// Abstract base class for all logger sinks.
       class SinkBase : public RuntimeLogLevelList {
         public:
@@ -104,6 +242,38 @@ namespace atom {
             }
           }
 
+          /**
+           * Send a structured log message with deferred formatting to this sink.
+           * The message is filtered according to its log level and passed to {@link #AppendDeferredImpl}
+           * only if the log level is enabled for this sink.
+           * @param message the structured log message
+           */
+          void AppendDeferred(DeferredMessage const& message) {
+            if(GetLogLevelEnable(message.level)) {
+              AppendDeferredImpl(message);
+            }
+          }
+
+          /**
+           * Send a batch of structured log messages to this sink.
+           * Sinks may override {@link #AppendBatchImpl} to deliver the whole batch at once (e.g. in a single write).
+           * @param messages the structured log messages
+           */
+          void AppendBatch(std::span<const Message> messages) {
+            AppendBatchImpl(messages);
+          }
+
+          /**
+           * Write out any messages that are buffered by this sink.
+           * The default implementation does nothing.
+           */
+          virtual void Flush() {}
+
+          /// @returns whether this sink overrides {@link #AppendDeferredImpl} to handle unformatted messages itself
+          [[nodiscard]] virtual bool AcceptsDeferred() const {
+            return false;
+          }
+
         protected:
           /**
            * Detail for sending a structured log message to this sink.
@@ -111,35 +281,136 @@ namespace atom {
            * @param message the structured log message
            */
           virtual void AppendImpl(Message const& message) = 0;
+
+          /**
+           * Detail for sending a batch of structured log messages to this sink.
+           * Unlike {@link #AppendImpl} this receives messages of all log levels, so implementations must
+           * filter messages with {@link #GetLogLevelEnable} themselves.
+           * The default implementation passes each message to {@link #Append}.
+           * @param messages the structured log messages
+           */
+          virtual void AppendBatchImpl(std::span<const Message> messages) {
+            for(auto const& message : messages) {
+              Append(message);
+            }
+          }
+
+          /**
+           * Detail for sending a structured log message with deferred formatting to this sink.
+           * The default implementation formats the message and passes it to {@link #AppendImpl}.
+           * @param message the structured log message
+           */
+          virtual void AppendDeferredImpl(DeferredMessage const& message) {
+            fmt::memory_buffer buffer;
+            message.FormatTo(buffer);
+            AppendImpl({message.level, message.time, message.component, {buffer.data(), buffer.size()}});
+          }
       };
 
-      /// A collection of logger sinks
+      /**
+       * A collection of logger sinks.
+       * Sinks may be installed and removed from any thread, even while messages are being logged.
+       * The list of sinks is an immutable snapshot that is replaced as a whole on modification,
+       * so appending a message never blocks and never touches the reference counts of the sinks.
+       */
       class SinkCollection : public SinkBase {
         public:
+          SinkCollection();
+         ~SinkCollection() override;
+
+          SinkCollection(SinkCollection const&) = delete;
+          SinkCollection& operator=(SinkCollection const&) = delete;
+
           /// Add a sink to the collection
-          void Install(std::shared_ptr<SinkBase> const& sink) {
-            sinks.push_back(sink);
-          }
+          void Install(std::shared_ptr<SinkBase> const& sink);
+
+          /**
+           * Remove a sink from the collection.
+           * Unless called from within a sink of this collection, this waits until messages that are
+           * concurrently being appended to the sink have been delivered.
+           */
+          void Remove(std::shared_ptr<SinkBase> const& sink);
+
+          /// @returns a copy of the list of all registered sinks
+          [[nodiscard]] std::vector<std::shared_ptr<SinkBase>> GetSinks() const;
 
-          /// Remove a sink from the collection
-          void Remove(std::shared_ptr<SinkBase> const& sink) {
-            sinks.erase(std::remove(sinks.begin(), sinks.end(), sink), sinks.end());
+          /// Flush all registered sinks
+          void Flush() override {
+            const detail::EpochReadSection read_section{};
+
+            for(auto& sink : snapshot.load()->sinks) {
+              sink->Flush();
+            }
           }
 
-          /// @returns a span referring to all registered sinks
-          [[nodiscard]] std::span<const std::shared_ptr<SinkBase>> AsSpan() {
-            return sinks;
+          [[nodiscard]] bool AcceptsDeferred() const override {
+            return true;
           }
 
         protected:
           void AppendImpl(Message const& message) override {
-            for(auto& sink : sinks) {
+            const detail::EpochReadSection read_section{};
+
+            for(auto& sink : snapshot.load()->sinks) {
               sink->Append(message);
             }
           }
 
+          void AppendBatchImpl(std::span<const Message> messages) override {
+            // Messages that are filtered by the collection itself must not reach the sinks.
+            const bool all_enabled = std::all_of(messages.begin(), messages.end(), [this](Message const& message) {
+              return GetLogLevelEnable(message.level);
+            });
+
+            if(!all_enabled) {
+              SinkBase::AppendBatchImpl(messages);
+              return;
+            }
+
+            const detail::EpochReadSection read_section{};
+
+            for(auto& sink : snapshot.load()->sinks) {
+              sink->AppendBatch(messages);
+            }
+          }
+
+          void AppendDeferredImpl(DeferredMessage const& message) override {
+            const detail::EpochReadSection read_section{};
+
+            // Sinks that do not handle deferred messages themselves share a single formatted copy of the message.
+            detail::StagingBuffer buffer{};
+            bool formatted = false;
+
+            for(auto& sink : snapshot.load()->sinks) {
+              if(sink->AcceptsDeferred()) {
+                sink->AppendDeferred(message);
+              } else if(sink->GetLogLevelEnable(message.level)) {
+                if(!formatted) {
+                  message.FormatTo(buffer.Get());
+                  formatted = true;
+                }
+                sink->Append({message.level, message.time, message.component, {buffer.Get().data(), buffer.Get().size()}});
+              }
+            }
+          }
+
         private:
-          std::vector<std::shared_ptr<SinkBase>> sinks; ///< list of all registered sinks
+          /// An immutable list of sinks
+          struct Snapshot {
+            std::vector<std::shared_ptr<SinkBase>> sinks;
+          };
+
+          /// A snapshot that has been replaced, but may still be in use by readers
+          struct RetiredSnapshot {
+            Snapshot const* snapshot;
+            u64 epoch;
+          };
+
+          void Publish(std::vector<std::shared_ptr<SinkBase>> sinks, bool wait_for_readers);
+
+          std::atomic<Snapshot const*> snapshot; ///< the current list of all registered sinks
+          std::mutex writer_mutex;
+          std::vector<RetiredSnapshot> retired_snapshots;
       };
 
       /// Create a nameless logger with a new sink collection
@@ -169,20 +440,86 @@ namespace atom {
        * Log a formatted message to this logger
        * @tparam level the log level
        * @tparam Args
-       * @param format the message format
+       * @param format the message format, which is checked at compile time (use fmt::runtime() for runtime strings)
+       * @param args the variable arguments for formatting the message
+       */
+      template<Level level, typename... Args>
+      void Log(fmt::format_string<Args...> format, Args&&... args) const {
+        if constexpr(k_build_log_mask & level) {
+          if(is_log_level_enabled_globally(level) && GetLogLevelEnable(level)) {
+            detail::StagingBuffer buffer{};
+            fmt::format_to(std::back_inserter(buffer.Get()), format, std::forward<Args>(args)...);
+
+            SendMessage({level, GetCurrentTime(), name, {buffer.Get().data(), buffer.Get().size()}});
+          }
+        }
+      }
+
+      /**
+       * Log a formatted message with structured fields to this logger.
+       * The fields are passed to the sinks as they are, without being copied or formatted into the message text:
+       * `logger.Log<atom::Info>({{"user", user_id}, {"latency_ms", 12.5}}, "request completed")`
+       * @tparam level the log level
+       * @tparam Args
+       * @param fields the key/value fields of the message
+       * @param format the message format, which is checked at compile time (use fmt::runtime() for runtime strings)
+       * @param args the variable arguments for formatting the message
+       */
+      template<Level level, typename... Args>
+      void Log(std::initializer_list<Field> fields, fmt::format_string<Args...> format, Args&&... args) const {
+        if constexpr(k_build_log_mask & level) {
+          if(is_log_level_enabled_globally(level) && GetLogLevelEnable(level)) {
+            detail::StagingBuffer buffer{};
+            fmt::format_to(std::back_inserter(buffer.Get()), format, std::forward<Args>(args)...);
+
+            SendMessage({level, GetCurrentTime(), name, {buffer.Get().data(), buffer.Get().size()}, {fields.begin(), fields.size()}});
+          }
+        }
+      }
+
+      /**
+       * Log a message to this logger, but defer formatting it to the sinks.
+       * The arguments are stored in a packed argument buffer, which allows sinks such as {@link #LoggerAsyncSink}
+       * to move the formatting cost off the calling thread. Messages with arguments that cannot be packed
+       * (@see #PackedArgumentType) or that exceed {@link #k_max_packed_arguments_size} are formatted immediately.
+       * @tparam level the log level
+       * @tparam Args
+       * @param format the message format, which must have static storage duration (e.g. a string literal).
+       *               Runtime format strings (fmt::runtime()) are rejected at compile time, use {@link #Log} for those.
        * @param args the variable arguments for formatting the message
        */
       template<Level level, typename... Args>
-      void Log(std::string_view format, Args&&... args) const {
+      void LogDeferred(fmt::format_string<Args...> format, Args&&... args) const {
         if constexpr(k_build_log_mask & level) {
-          if(GetLogLevelEnable(level)) {
-            std::string text = fmt::format(fmt::runtime(format), std::forward<Args>(args)...);
+          if(is_log_level_enabled_globally(level) && GetLogLevelEnable(level)) {
+            if constexpr((detail::Packable<Args> && ...)) {
+              const size_t size = detail::get_packed_size(args...);
+
+              if(size <= k_max_packed_arguments_size) {
+                std::array<u8, k_max_packed_arguments_size> arguments;
+                detail::pack_arguments(arguments.data(), args...);
+
+                const fmt::string_view format_view = format;
 
-            SendMessage({level, GetCurrentTime(), name, text});
+                sink_collection->AppendDeferred({
+                  level, GetCurrentTime(), name, {format_view.data(), format_view.size()}, {arguments.data(), size}});
+                return;
+              }
+            }
+
+            Log<level>(format, std::forward<Args>(args)...);
           }
         }
       }
 
+      /**
+       * Deferred messages keep a reference to their format string until a sink formats them, possibly on another thread.
+       * Runtime format strings may not outlive the call, so they cannot be deferred.
+       */
+      template<Level level, typename... Args>
+        requires (!std::is_same_v<detail::RuntimeFormatString, fmt::string_view>)
+      void LogDeferred(detail::RuntimeFormatString format, Args&&... args) const = delete;
+
       /// Add a sink to the currently used sink collection
       void InstallSink(std::shared_ptr<SinkBase> const& sink) {
         sink_collection->Install(sink);
@@ -193,27 +530,19 @@ namespace atom {
         sink_collection->Remove(sink);
       }
 
-    private:
-#if defined(NDEBUG)
-      static constexpr int k_build_log_mask = Info | Warn | Error | Fatal;
-#else
-      static constexpr int k_build_log_mask = All;
-#endif
+      /// Report pending suppressed message counts (@see #report_suppressed_messages) and flush all sinks of the currently used sink collection
+      void Flush() const {
+        report_suppressed_messages();
+        sink_collection->Flush();
+      }
 
+    private:
       void SendMessage(Message const& message) const {
         sink_collection->Append(message);
       }
 
-      static Message::Time GetCurrentTime() {
-        // @todo std::localtime() is not thread-safe.
-        std::time_t time = std::time(nullptr);
-        std::tm* local_time = std::localtime(&time);
-        int hour = local_time->tm_hour;
-        int minute = local_time->tm_min;
-        int second = local_time->tm_sec;
-
-        return {hour, minute, second};
-      }
+      /// @returns the current local time with microsecond resolution
+      static Message::Time GetCurrentTime();
 
       std::optional<std::string> name;
       std::shared_ptr<SinkCollection> sink_collection;
@@ -222,12 +551,79 @@ namespace atom {
   /// @returns the default logger (as used by ATOM_INFO, ATOM_WARN macros etc.)
   Logger& get_logger();
 
-  /// @returns a named logger. A logger is created if the name is not known yet.
-  Logger& get_named_logger(std::string const& name);
+  /**
+   * @returns a named logger. A logger is created if the name is not known yet.
+   * Safe to call from multiple threads. Looking up an existing logger only takes a shared lock.
+   * Use a {@link #LoggerRef} to avoid repeated lookups in frequently called code.
+   */
+  Logger& get_named_logger(std::string_view name);
+
+  /**
+   * A lazily resolved reference to a named logger (@see #get_named_logger).
+   * The logger is looked up once on first use and cached afterwards, so a LoggerRef is best kept in a static variable:
+   * `static atom::LoggerRef logger{"network"}; logger->Log<atom::Info>("connected");`
+   */
+  class LoggerRef {
+    public:
+      /// @param name the name of the logger, which must outlive the reference (e.g. a string literal)
+      explicit constexpr LoggerRef(std::string_view name) : name{name} {}
+
+      LoggerRef(LoggerRef const&) = delete;
+      LoggerRef& operator=(LoggerRef const&) = delete;
+
+      /// @returns the referenced logger
+      [[nodiscard]] Logger& Get() const {
+        Logger* logger = cached_logger.load(std::memory_order_acquire);
+
+        if(logger == nullptr) [[unlikely]] {
+          logger = &get_named_logger(name);
+          cached_logger.store(logger, std::memory_order_release);
+        }
+        return *logger;
+      }
+
+      Logger* operator->() const {
+        return &Get();
+      }
+
+      Logger& operator*() const {
+        return Get();
+      }
+
+    private:
+      std::string_view name;
+      mutable std::atomic<Logger*> cached_logger{nullptr};
+  };
 
 } // namespace atom
 
-#define ATOM_LOG(level, format, ...) atom::get_logger().Log<level>(format, ## __VA_ARGS__);
+/**
+ * Log a message to the default logger.
+ * The level is checked at compile time, against the global log mask and against the default logger
+ * before the message arguments are evaluated. Expensive arguments cost nothing when the level is disabled.
+ */
+#define ATOM_LOG(level, format, ...) do { \
+    if constexpr((atom::Logger::k_build_log_mask & (level)) != 0) { \
+      if(atom::is_log_level_enabled_globally(level)) { \
+        atom::Logger& atom_logger_ = atom::get_logger(); \
+        if(atom_logger_.GetLogLevelEnable(level)) { \
+          atom_logger_.Log<level>(format, ## __VA_ARGS__); \
+        } \
+      } \
+    } \
+  } while(0)
+
+/// Log a message with deferred formatting to the default logger (@see #Logger::LogDeferred, #ATOM_LOG)
+#define ATOM_LOG_DEFERRED(level, format, ...) do { \
+    if constexpr((atom::Logger::k_build_log_mask & (level)) != 0) { \
+      if(atom::is_log_level_enabled_globally(level)) { \
+        atom::Logger& atom_logger_ = atom::get_logger(); \
+        if(atom_logger_.GetLogLevelEnable(level)) { \
+          atom_logger_.LogDeferred<level>(format, ## __VA_ARGS__); \
+        } \
+      } \
+    } \
+  } while(0)
 
 #define ATOM_TRACE(format, ...) ATOM_LOG(atom::Trace, format, ## __VA_ARGS__)
 #define ATOM_DEBUG(format, ...) ATOM_LOG(atom::Debug, format, ## __VA_ARGS__)
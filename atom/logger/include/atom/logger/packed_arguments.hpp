@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/meta.hpp>
+#include <cstring>
+#include <fmt/format.h>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace atom {
+
+  /**
+   * Type tags of the arguments in a packed argument buffer.
+   * Each packed argument consists of its type tag followed by its value.
+   * Strings are stored as a 32-bit length followed by the characters (without null-terminator).
+   */
+  enum class PackedArgumentType : u8 {
+    Bool    = 0,
+    Char    = 1,
+    S32     = 2,
+    U32     = 3,
+    S64     = 4,
+    U64     = 5,
+    F32     = 6,
+    F64     = 7,
+    Pointer = 8,
+    String  = 9
+  };
+
+  namespace detail {
+
+    template<typename T>
+    inline constexpr bool is_packable_string_v =
+      std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+      std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>;
+
+    template<typename T>
+    inline constexpr bool is_packable_pointer_v =
+      std::is_same_v<T, const void*> || std::is_same_v<T, void*> || std::is_same_v<T, std::nullptr_t>;
+
+    template<typename T>
+    consteval std::optional<PackedArgumentType> get_packed_argument_type() {
+      if constexpr(std::is_same_v<T, bool>) {
+        return PackedArgumentType::Bool;
+      } else if constexpr(std::is_same_v<T, char>) {
+        return PackedArgumentType::Char;
+      } else if constexpr(is_one_of_v<T, wchar_t, char8_t, char16_t, char32_t>) {
+        return std::nullopt;
+      } else if constexpr(std::is_integral_v<T> && sizeof(T) <= sizeof(u32)) {
+        return std::is_signed_v<T> ? PackedArgumentType::S32 : PackedArgumentType::U32;
+      } else if constexpr(std::is_integral_v<T> && sizeof(T) == sizeof(u64)) {
+        return std::is_signed_v<T> ? PackedArgumentType::S64 : PackedArgumentType::U64;
+      } else if constexpr(std::is_same_v<T, float>) {
+        return PackedArgumentType::F32;
+      } else if constexpr(std::is_same_v<T, double>) {
+        return PackedArgumentType::F64;
+      } else if constexpr(is_packable_pointer_v<T>) {
+        return PackedArgumentType::Pointer;
+      } else if constexpr(is_packable_string_v<T>) {
+        return PackedArgumentType::String;
+      } else {
+        return std::nullopt;
+      }
+    }
+
+    /// Satisfied by argument types that can be stored in a packed argument buffer.
+    template<typename T>
+    concept Packable = get_packed_argument_type<std::decay_t<T>>().has_value();
+
+    template<typename T>
+    auto to_packed_value(T const& value) {
+      using U = std::decay_t<T>;
+
+      constexpr PackedArgumentType type = get_packed_argument_type<U>().value();
+
+      if constexpr(type == PackedArgumentType::Bool)    return (u8)value;
+      if constexpr(type == PackedArgumentType::Char)    return value;
+      if constexpr(type == PackedArgumentType::S32)     return (s32)value;
+      if constexpr(type == PackedArgumentType::U32)     return (u32)value;
+      if constexpr(type == PackedArgumentType::S64)     return (s64)value;
+      if constexpr(type == PackedArgumentType::U64)     return (u64)value;
+      if constexpr(type == PackedArgumentType::F32)     return value;
+      if constexpr(type == PackedArgumentType::F64)     return value;
+      if constexpr(type == PackedArgumentType::Pointer) {
+        if constexpr(std::is_same_v<U, std::nullptr_t>) {
+          return u64{0};
+        } else {
+          return (u64)reinterpret_cast<std::uintptr_t>(value);
+        }
+      }
+      if constexpr(type == PackedArgumentType::String) {
+        // Test T rather than U: string literals (arrays) decay to pointers, but are never null.
+        if constexpr(std::is_pointer_v<T>) {
+          return value != nullptr ? std::string_view{value} : std::string_view{"(null)"};
+        } else {
+          return std::string_view{value};
+        }
+      }
+    }
+
+    /// @returns the number of bytes required to store the arguments in a packed argument buffer
+    template<Packable... Args>
+    size_t get_packed_size(Args const&... args) {
+      const auto get_size = [](auto const& arg) -> size_t {
+        const auto packed_value = to_packed_value(arg);
+
+        if constexpr(std::is_same_v<decltype(packed_value), const std::string_view>) {
+          return sizeof(PackedArgumentType) + sizeof(u32) + packed_value.size();
+        } else {
+          return sizeof(PackedArgumentType) + sizeof(packed_value);
+        }
+      };
+
+      return (size_t{0} + ... + get_size(args));
+    }
+
+    /**
+     * Store arguments in a packed argument buffer.
+     * @param destination the buffer, which must be at least {@link #get_packed_size} bytes large
+     * @param args the arguments
+     */
+    template<Packable... Args>
+    void pack_arguments(u8* destination, Args const&... args) {
+      const auto pack = [&](auto const& arg) {
+        const auto packed_value = to_packed_value(arg);
+
+        *destination++ = (u8)get_packed_argument_type<std::decay_t<decltype(arg)>>().value();
+
+        if constexpr(std::is_same_v<decltype(packed_value), const std::string_view>) {
+          const u32 length = (u32)packed_value.size();
+          std::memcpy(destination, &length, sizeof(u32));
+          std::memcpy(destination + sizeof(u32), packed_value.data(), length);
+          destination += sizeof(u32) + length;
+        } else {
+          std::memcpy(destination, &packed_value, sizeof(packed_value));
+          destination += sizeof(packed_value);
+        }
+      };
+
+      (pack(args), ...);
+    }
+
+    /**
+     * Format a message from a format string and a packed argument buffer.
+     * @param buffer    the buffer which the formatted message is appended to
+     * @param format    the format string
+     * @param arguments the packed argument buffer
+     * @returns false if the packed argument buffer is malformed and true otherwise
+     */
+    bool format_packed_arguments(fmt::memory_buffer& buffer, std::string_view format, std::span<const u8> arguments);
+
+  } // namespace atom::detail
+
+} // namespace atom
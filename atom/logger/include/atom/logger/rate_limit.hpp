@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/logger/logger.hpp>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <type_traits>
+
+namespace atom::detail {
+
+  class SuppressedMessageCounter;
+
+  /// Add a counter to the registry of {@link #report_suppressed_messages}. The counter must never be destroyed.
+  void register_suppressed_message_counter(SuppressedMessageCounter* counter);
+
+  /**
+   * Counts the messages that a rate limited or sampled call site suppressed.
+   * A counter adds itself to a global registry when it first suppresses a message, which allows
+   * {@link #report_suppressed_messages} to report the pending count after the burst of messages ended.
+   * Counters live in static variables of the logging macros, must never be destroyed and are therefore trivially destructible.
+   */
+  class SuppressedMessageCounter {
+    public:
+      constexpr SuppressedMessageCounter(Level level, const char* file, u32 line) : level{level}, file{file}, line{line} {}
+
+      /// Count a suppressed message
+      void Add() {
+        suppressed_count.fetch_add(1u, std::memory_order_relaxed);
+
+        if(!registered.load(std::memory_order_relaxed) && !registered.exchange(true, std::memory_order_relaxed)) {
+          register_suppressed_message_counter(this);
+        }
+      }
+
+      /// @returns the number of messages suppressed since the last call and resets it to zero
+      u64 Take() {
+        return suppressed_count.exchange(0u, std::memory_order_relaxed);
+      }
+
+      [[nodiscard]] Level GetLevel() const {
+        return level;
+      }
+
+      [[nodiscard]] const char* GetFile() const {
+        return file;
+      }
+
+      [[nodiscard]] u32 GetLine() const {
+        return line;
+      }
+
+    private:
+      Level level;
+      const char* file;
+      u32 line;
+      std::atomic<u64> suppressed_count{0};
+      std::atomic<bool> registered{false};
+  };
+
+  /// Per-call-site state of {@link #ATOM_LOG_RATE_LIMITED}. Allows up to N messages per second.
+  class RateLimiter : public SuppressedMessageCounter {
+    public:
+      constexpr RateLimiter(u32 max_per_second, Level level, const char* file, u32 line)
+          : SuppressedMessageCounter{level, file, line}, max_per_second{max_per_second} {}
+
+      /**
+       * Try to acquire permission to log a message.
+       * @returns std::nullopt if the message must be suppressed. Otherwise the number of messages suppressed
+       *          since the last permitted message or report (non-zero only for the first message of a new one-second interval).
+       */
+      std::optional<u64> Acquire() {
+        const u32 second = (u32)std::chrono::duration_cast<std::chrono::seconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        // The state packs the current one-second interval (upper 32 bits) and the number of messages logged in it.
+        u64 state = this->state.load(std::memory_order_relaxed);
+
+        while(true) {
+          const u32 state_second = (u32)(state >> 32);
+          const u32 count = (u32)state;
+
+          if(state_second != second) {
+            if(this->state.compare_exchange_weak(state, ((u64)second << 32) | 1u, std::memory_order_relaxed)) {
+              return Take();
+            }
+          } else if(count < max_per_second) {
+            if(this->state.compare_exchange_weak(state, state + 1u, std::memory_order_relaxed)) {
+              return 0u;
+            }
+          } else {
+            Add();
+            return std::nullopt;
+          }
+        }
+      }
+
+    private:
+      u32 max_per_second;
+      std::atomic<u64> state{0};
+  };
+
+  /// Per-call-site state of {@link #ATOM_LOG_SAMPLED}. Allows one in K messages.
+  class Sampler : public SuppressedMessageCounter {
+    public:
+      constexpr Sampler(u32 one_in, Level level, const char* file, u32 line)
+          : SuppressedMessageCounter{level, file, line}, one_in{one_in > 0u ? one_in : 1u} {}
+
+      /// @returns whether the message may be logged
+      bool Acquire() {
+        if(counter.fetch_add(1u, std::memory_order_relaxed) % one_in == 0u) {
+          return true;
+        }
+        Add();
+        return false;
+      }
+
+    private:
+      u32 one_in;
+      std::atomic<u64> counter{0};
+  };
+
+  static_assert(std::is_trivially_destructible_v<RateLimiter> && std::is_trivially_destructible_v<Sampler>);
+
+} // namespace atom::detail
+
+/**
+ * Log a message at most `max_per_second` times per second from this call site.
+ * Suppressed messages are neither formatted nor sent to the sinks.
+ * The number of suppressed messages is reported by the next message that the rate limit permits from this
+ * call site, just before that message. If the burst ends instead, the count is reported by the next
+ * {@link #Logger::Flush} (of any logger) or at exit (@see #report_suppressed_messages).
+ */
+#define ATOM_LOG_RATE_LIMITED(level, max_per_second, format, ...) do { \
+    if constexpr((atom::Logger::k_build_log_mask & (level)) != 0) { \
+      static atom::detail::RateLimiter atom_rate_limiter_{max_per_second, level, __FILE__, __LINE__}; \
+      if(atom::is_log_level_enabled_globally(level)) { \
+        atom::Logger& atom_logger_ = atom::get_logger(); \
+        if(atom_logger_.GetLogLevelEnable(level)) { \
+          if(const auto atom_suppressed_count_ = atom_rate_limiter_.Acquire()) { \
+            if(*atom_suppressed_count_ > 0u) { \
+              atom_logger_.Log<level>("suppressed {} messages from {}:{}", *atom_suppressed_count_, __FILE__, __LINE__); \
+            } \
+            atom_logger_.Log<level>(format, ## __VA_ARGS__); \
+          } \
+        } \
+      } \
+    } \
+  } while(0)
+
+/**
+ * Log only one in `one_in` messages from this call site.
+ * Skipped messages are neither formatted nor sent to the sinks. Their number is reported by the next
+ * {@link #Logger::Flush} (of any logger) or at exit (@see #report_suppressed_messages).
+ */
+#define ATOM_LOG_SAMPLED(level, one_in, format, ...) do { \
+    if constexpr((atom::Logger::k_build_log_mask & (level)) != 0) { \
+      static atom::detail::Sampler atom_sampler_{one_in, level, __FILE__, __LINE__}; \
+      if(atom::is_log_level_enabled_globally(level)) { \
+        atom::Logger& atom_logger_ = atom::get_logger(); \
+        if(atom_logger_.GetLogLevelEnable(level) && atom_sampler_.Acquire()) { \
+          atom_logger_.Log<level>(format, ## __VA_ARGS__); \
+        } \
+      } \
+    } \
+  } while(0)
+
+#define ATOM_TRACE_RATE_LIMITED(max_per_second, format, ...) ATOM_LOG_RATE_LIMITED(atom::Trace, max_per_second, format, ## __VA_ARGS__)
+#define ATOM_DEBUG_RATE_LIMITED(max_per_second, format, ...) ATOM_LOG_RATE_LIMITED(atom::Debug, max_per_second, format, ## __VA_ARGS__)
+#define ATOM_INFO_RATE_LIMITED(max_per_second, format, ...)  ATOM_LOG_RATE_LIMITED(atom::Info,  max_per_second, format, ## __VA_ARGS__)
+#define ATOM_WARN_RATE_LIMITED(max_per_second, format, ...)  ATOM_LOG_RATE_LIMITED(atom::Warn,  max_per_second, format, ## __VA_ARGS__)
+#define ATOM_ERROR_RATE_LIMITED(max_per_second, format, ...) ATOM_LOG_RATE_LIMITED(atom::Error, max_per_second, format, ## __VA_ARGS__)
+#define ATOM_FATAL_RATE_LIMITED(max_per_second, format, ...) ATOM_LOG_RATE_LIMITED(atom::Fatal, max_per_second, format, ## __VA_ARGS__)
+
+#define ATOM_TRACE_SAMPLED(one_in, format, ...) ATOM_LOG_SAMPLED(atom::Trace, one_in, format, ## __VA_ARGS__)
+#define ATOM_DEBUG_SAMPLED(one_in, format, ...) ATOM_LOG_SAMPLED(atom::Debug, one_in, format, ## __VA_ARGS__)
+#define ATOM_INFO_SAMPLED(one_in, format, ...)  ATOM_LOG_SAMPLED(atom::Info,  one_in, format, ## __VA_ARGS__)
+#define ATOM_WARN_SAMPLED(one_in, format, ...)  ATOM_LOG_SAMPLED(atom::Warn,  one_in, format, ## __VA_ARGS__)
+#define ATOM_ERROR_SAMPLED(one_in, format, ...) ATOM_LOG_SAMPLED(atom::Error, one_in, format, ## __VA_ARGS__)
+#define ATOM_FATAL_SAMPLED(one_in, format, ...) ATOM_LOG_SAMPLED(atom::Fatal, one_in, format, ## __VA_ARGS__)
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/logger/logger.hpp>
+#include <atom/non_copyable.hpp>
+#include <array>
+#include <atomic>
+#include <fmt/format.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace atom {
+
+  /**
+   * Forwards messages to another sink from a dedicated backend thread.
+   * Logging threads copy messages into a bounded lock-free ring buffer, which is drained by the backend thread.
+   * This keeps slow sinks (e.g. console or file sinks) from stalling the threads that log messages.
+   * Messages logged with {@link #Logger::LogDeferred} are formatted on the backend thread.
+   * Up to {@link #k_max_fields} structured fields per message are retained, any further fields are discarded.
+   * The backend thread passes messages to the target sink in batches (@see #Logger::SinkBase::AppendBatch).
+   * The target sink is only ever accessed from the backend thread.
+   * When the program crashes, a crash hook (@see #register_crash_hook) gives the backend thread a short amount of time
+   * to pass the remaining messages to the target sink and to flush it.
+   */
+  class LoggerAsyncSink final : public Logger::SinkBase, NonCopyable {
+    public:
+      /// The maximum number of structured fields that are retained per message
+      static constexpr size_t k_max_fields = 16;
+
+      /// Describes what happens to a message that is logged while the ring buffer is full.
+      enum class OverflowPolicy {
+        Block,      ///< Wait until the backend thread has made space for the message
+        DropNewest, ///< Discard the message that is being logged
+        DropOldest  ///< Discard the oldest message in the ring buffer to make space for the message
+      };
+
+      /**
+       * Creates a new asynchronous sink and starts its backend thread.
+       * @param target          the sink that receives the messages on the backend thread
+       * @param capacity        the number of messages that the ring buffer can hold (rounded up to a power of two)
+       * @param overflow_policy how to deal with messages that are logged while the ring buffer is full
+       */
+      explicit LoggerAsyncSink(
+        std::shared_ptr<SinkBase> target,
+        size_t capacity = 8192,
+        OverflowPolicy overflow_policy = OverflowPolicy::Block
+      );
+
+      /// Passes all remaining messages to the target sink and stops the backend thread.
+     ~LoggerAsyncSink() override;
+
+      /**
+       * Blocks until all messages that were logged before the call have been passed to the target sink
+       * and the target sink has been flushed.
+       */
+      void Flush() override;
+
+      /// @returns the number of messages that were discarded because the ring buffer was full
+      [[nodiscard]] u64 GetDroppedCount() const {
+        return dropped_count.load(std::memory_order_relaxed);
+      }
+
+      [[nodiscard]] bool AcceptsDeferred() const override {
+        return true;
+      }
+
+    protected:
+      void AppendImpl(Logger::Message const& message) override;
+      void AppendDeferredImpl(Logger::DeferredMessage const& message) override;
+
+    private:
+      static constexpr size_t k_batch_size = 64;
+      static constexpr int k_spin_count = 64;
+      static constexpr int k_crash_flush_timeout_ms = 1000;
+
+      struct Slot {
+        std::atomic<u64> sequence;
+        Level level;
+        Logger::Message::Time time;
+        bool has_component;
+        std::string component;
+        bool deferred;
+        std::string text;
+        std::string_view format;
+        size_t arguments_size;
+        std::array<u8, Logger::k_max_packed_arguments_size> arguments;
+        size_t field_count;
+        std::array<Logger::Field, k_max_fields> fields;
+        std::string field_strings; ///< backing storage for the keys and string values of the fields
+      };
+
+      template<typename WriteSlot>
+      void Enqueue(WriteSlot&& write_slot);
+
+      template<typename WriteSlot>
+      bool TryEnqueue(WriteSlot&& write_slot);
+
+      static void CopyFields(Slot& slot, std::span<const Logger::Field> fields);
+
+      bool TryClaim(u64& position, Slot*& slot);
+      void Release(u64 position, Slot& slot);
+      bool TryDropOldest();
+      size_t ForwardBatch();
+      [[nodiscard]] bool IsEmpty() const;
+
+      u64 RequestFlush();
+      static void EmergencyFlush(void* user_data);
+
+      void WakeBackend();
+      void RunBackend();
+
+      std::shared_ptr<SinkBase> target;
+      OverflowPolicy overflow_policy;
+
+      std::unique_ptr<Slot[]> slots;
+      size_t slot_mask;
+
+      alignas(64) std::atomic<u64> enqueue_position{0};
+      alignas(64) std::atomic<u64> dequeue_position{0};
+      alignas(64) std::atomic<u64> completed_count{0};
+      std::atomic<u64> dropped_count{0};
+
+      std::atomic<u64> flush_request{0};
+      std::atomic<u64> flushed_count{0};
+
+      std::atomic_bool backend_sleeping{false};
+      std::atomic<u32> wakeup_counter{0};
+      std::atomic_bool stop{false};
+      std::thread backend_thread;
+      fmt::memory_buffer format_buffer; ///< only accessed from the backend thread
+      std::vector<Logger::Message> batch; ///< only accessed from the backend thread
+      int crash_hook{-1};
+  };
+
+} // namespace atom
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atom/hash.hpp>
+#include <atom/integer.hpp>
+#include <atom/logger/binary_log.hpp>
+#include <atom/logger/logger.hpp>
+#include <atom/non_copyable.hpp>
+#include <cstdio>
+#include <fmt/format.h>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace atom {
+
+  /**
+   * Logs messages into a file in a compact binary format (@see #binary_log).
+   * Messages logged with {@link #Logger::LogDeferred} are stored unformatted as a format string ID
+   * and the packed arguments, which is much cheaper than formatting the message text.
+   * Binary logs can be converted to text using the atom-log-decode tool or {@link #BinaryLogReader}.
+   * Structured fields (@see Logger::Message::fields) are not stored and are dropped.
+   *
+   * This sink is not thread-safe. Wrap it in a {@link #LoggerAsyncSink} to log from multiple threads.
+   */
+  class LoggerBinarySink final : public Logger::SinkBase, NonCopyable {
+    public:
+      /**
+       * Creates a new binary file sink. The current contents of the log file are discarded.
+       * @param path the path to the log file
+       */
+      explicit LoggerBinarySink(std::string const& path);
+
+     ~LoggerBinarySink() override;
+
+      void Flush() override;
+
+      [[nodiscard]] bool AcceptsDeferred() const override {
+        return true;
+      }
+
+    protected:
+      void AppendImpl(Logger::Message const& message) override;
+      void AppendDeferredImpl(Logger::DeferredMessage const& message) override;
+
+    private:
+      struct FormatKeyHash {
+        size_t operator()(std::pair<const char*, size_t> const& key) const;
+      };
+
+      u16 GetComponentID(std::optional<std::string_view> component);
+      u32 GetFormatID(std::string_view format);
+
+      void WriteMessage(
+        Level level,
+        Logger::Message::Time const& time,
+        std::optional<std::string_view> component,
+        std::string_view format,
+        std::span<const u8> arguments
+      );
+
+      template<typename T>
+      void Write(T const& value) {
+        record_buffer.append((const char*)&value, (const char*)&value + sizeof(T));
+      }
+
+      std::FILE* file;
+      fmt::memory_buffer record_buffer{};
+      fmt::memory_buffer arguments_buffer{};
+      std::unordered_map<std::string, u16, StringHash, std::equal_to<>> component_ids{};
+      std::unordered_map<std::pair<const char*, size_t>, u32, FormatKeyHash> format_ids{};
+  };
+
+} // namespace atom
@@ -1,14 +1,21 @@
-
 #pragma once
 
 #include <atom/logger/logger.hpp>
+#include <fmt/format.h>
 
 namespace atom {
 
   /// Logs colored messages to the process's standard output handle
   class LoggerConsoleSink final : public Logger::SinkBase {
+    public:
+      void Flush() override;
+
     protected:
       void AppendImpl(Logger::Message const& message) override;
+      void AppendBatchImpl(std::span<const Logger::Message> messages) override;
+
+    private:
+      static void FormatTo(fmt::memory_buffer& buffer, Logger::Message const& message);
   };
 
-} // namespace atom
\ No newline at end of file
+} // namespace atom
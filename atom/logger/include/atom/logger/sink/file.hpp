@@ -16,13 +16,23 @@ namespace atom {
        */
       explicit LoggerFileSink(std::string const& path);
 
+      /**
+       * Creates a new file sink that logs into an open stream (e.g. stdout), which is flushed but not closed by the sink.
+       * @param file the stream, which must outlive the sink
+       */
+      explicit LoggerFileSink(std::FILE* file);
+
      ~LoggerFileSink() override;
 
+      void Flush() override;
+
     protected:
       void AppendImpl(Logger::Message const& message) override;
+      void AppendBatchImpl(std::span<const Logger::Message> messages) override;
 
     private:
       std::FILE* file;
+      bool owns_file{true};
   };
 
 } // namespace atom
\ No newline at end of file
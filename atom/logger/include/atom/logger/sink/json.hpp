@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atom/logger/logger.hpp>
+#include <cstdio>
+#include <string>
+
+namespace atom {
+
+  /**
+   * Logs messages into a file as JSON lines, with one JSON object per message:
+   * `{"level":"info","time":"12:34:56.789012","component":"atom","message":"text","fields":{"user":42}}`
+   * The structured fields of a message are stored in a nested `fields` object (omitted if there are none),
+   * so that log pipelines can ingest them without parsing the message text and field names cannot collide
+   * with the members of the message. Non-finite floating-point values are stored as `null`.
+   * Each line is written with a single fwrite(), so messages from multiple threads are not interleaved.
+   */
+  class LoggerJsonSink final : public Logger::SinkBase {
+    public:
+      /**
+       * Creates a new JSON sink. The current contents of the log file are discarded.
+       * @param path the path to the log file
+       */
+      explicit LoggerJsonSink(std::string const& path);
+
+     ~LoggerJsonSink() override;
+
+      void Flush() override;
+
+    protected:
+      void AppendImpl(Logger::Message const& message) override;
+
+    private:
+      std::FILE* file;
+  };
+
+} // namespace atom
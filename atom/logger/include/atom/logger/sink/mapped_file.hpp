@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/logger/logger.hpp>
+#include <atom/non_copyable.hpp>
+#include <fmt/format.h>
+#include <string>
+
+namespace atom {
+
+  /**
+   * Logs messages into a memory-mapped file.
+   * The file is preallocated and mapped in large chunks, so that appending a message is a plain memory copy
+   * and does not require a system call. Because the mapped pages are owned by the kernel, messages that were
+   * logged right before a crash still reach the file. After a crash the file may contain trailing zero bytes,
+   * since it is only truncated to its actual length when the sink is destroyed.
+   *
+   * This sink is not thread-safe. Wrap it in a {@link #LoggerAsyncSink} to log from multiple threads.
+   */
+  class LoggerMappedFileSink final : public Logger::SinkBase, NonCopyable {
+    public:
+      /**
+       * Creates a new memory-mapped file sink. The current contents of the log file are discarded.
+       * @param path       the path to the log file
+       * @param chunk_size the number of bytes by which the file and its mapping grow (rounded up to the page size)
+       */
+      explicit LoggerMappedFileSink(std::string const& path, size_t chunk_size = 16 * 1024 * 1024);
+
+     ~LoggerMappedFileSink() override;
+
+      /// Schedule writeback of the mapped pages to the storage device (without waiting for it)
+      void Flush() override;
+
+    protected:
+      void AppendImpl(Logger::Message const& message) override;
+
+    private:
+      void Grow(size_t minimum_capacity);
+
+      std::string path;
+      size_t chunk_size;
+      int file_descriptor{-1};
+      u8* data{nullptr};
+      size_t size{0};
+      size_t capacity{0};
+      fmt::memory_buffer line_buffer{};
+  };
+
+} // namespace atom
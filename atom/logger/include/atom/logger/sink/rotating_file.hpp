@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atom/integer.hpp>
+#include <atom/logger/logger.hpp>
+#include <atom/non_copyable.hpp>
+#include <atomic>
+#include <chrono>
+#include <fmt/format.h>
+#include <string>
+
+namespace atom {
+
+  /**
+   * Logs messages into a file, which is rotated once it exceeds a maximum size or age.
+   * Messages are collected in a user-space buffer and written to the file in large batches.
+   * On rotation the log file is renamed to `<path>.1`, the previous `<path>.1` to `<path>.2` and so on,
+   * and only a limited number of rotated files is retained.
+   *
+   * When the program crashes, buffered messages are written to the log file by a crash hook (@see #register_crash_hook).
+   * Messages that are still buffered are lost if the crash interrupts the sink while it appends a message or flushes,
+   * and messages that are logged after the crash hook ran are dropped.
+   *
+   * This sink is not thread-safe. Wrap it in a {@link #LoggerAsyncSink} to log from multiple threads.
+   */
+  class LoggerRotatingFileSink final : public Logger::SinkBase, NonCopyable {
+    public:
+      /// Describes when the log file is synchronized to the storage device (using fsync()).
+      enum class FsyncPolicy {
+        Never,   ///< Leave writeback to the operating system
+        OnError, ///< After each message with Error or Fatal log level
+        Periodic ///< When a message is logged and the last synchronization is older than the fsync interval
+      };
+
+      struct Options {
+        size_t max_file_size = 64 * 1024 * 1024;        ///< Rotate when the file would exceed this size (0 = unlimited)
+        std::chrono::seconds max_file_age{0};            ///< Rotate when the file is older than this (0 = unlimited)
+        int max_retained_files = 5;                      ///< The number of rotated files to keep
+        size_t buffer_size = 256 * 1024;                 ///< The size of the user-space write buffer
+        FsyncPolicy fsync_policy = FsyncPolicy::Never;
+        std::chrono::milliseconds fsync_interval{1000}; ///< The minimum interval between synchronizations with FsyncPolicy::Periodic
+      };
+
+      /**
+       * Creates a new rotating file sink with default options.
+       * Messages are appended to the log file if it already exists.
+       * @param path the path to the log file
+       */
+      explicit LoggerRotatingFileSink(std::string path);
+
+      /**
+       * Creates a new rotating file sink.
+       * Messages are appended to the log file if it already exists.
+       * @param path    the path to the log file
+       * @param options the options for buffering, rotation and synchronization
+       */
+      LoggerRotatingFileSink(std::string path, Options const& options);
+
+     ~LoggerRotatingFileSink() override;
+
+      /// Write all buffered messages to the log file.
+      void Flush() override;
+
+      /// @returns the number of write() or fsync() calls that failed
+      [[nodiscard]] u64 GetErrorCount() const {
+        return error_count;
+      }
+
+    protected:
+      void AppendImpl(Logger::Message const& message) override;
+
+    private:
+      using Clock = std::chrono::steady_clock;
+
+      void OpenFile();
+      void CloseFile();
+      void Rotate();
+      void WriteBuffer();
+      void Sync();
+
+      /// The crash hook, which writes out the buffer unless the sink is appending or flushing (@see #writing)
+      static void EmergencyFlush(void* user_data);
+
+      std::string path;
+      Options options;
+      int file_descriptor{-1};
+      size_t file_size{0};
+      Clock::time_point file_open_time{};
+      Clock::time_point last_sync_time{};
+      fmt::memory_buffer buffer{};
+      fmt::memory_buffer line_buffer{};
+      u64 error_count{0};
+      int crash_hook{-1};
+      std::atomic<bool> writing{false}; ///< Set while the buffer is modified, or for good once the crash hook ran
+  };
+
+} // namespace atom
@@ -0,0 +1,114 @@
+#include <atom/logger/binary_log.hpp>
+#include <algorithm>
+
+namespace atom {
+
+  BinaryLogReader::Status BinaryLogReader::Next(Logger::Message& message) {
+    if(!read_signature) {
+      std::array<char, binary_log::k_signature.size()> signature;
+      u8 version;
+
+      if(!Read(signature) || signature != binary_log::k_signature || !Read(version) || version != binary_log::k_version) {
+        return Status::Malformed;
+      }
+      read_signature = true;
+    }
+
+    while(true) {
+      binary_log::RecordType record_type;
+
+      if(std::fread(&record_type, sizeof(record_type), 1u, file) != 1u) {
+        return std::feof(file) ? Status::EndOfFile : Status::Malformed;
+      }
+
+      switch(record_type) {
+        case binary_log::RecordType::DefineComponent: {
+          u16 id;
+          u16 length;
+          // IDs are assigned in order, so a valid log only ever defines the next ID.
+          if(!Read(id) || !Read(length) || id == binary_log::k_no_component || id != components.size()) {
+            return Status::Malformed;
+          }
+          if(!ReadString(components.emplace_back().emplace(), length)) {
+            return Status::Malformed;
+          }
+          break;
+        }
+        case binary_log::RecordType::DefineFormat: {
+          u32 id;
+          u32 length;
+          if(!Read(id) || !Read(length) || id != formats.size() || length > binary_log::k_max_record_data_size) {
+            return Status::Malformed;
+          }
+          if(!ReadString(formats.emplace_back(), length)) {
+            return Status::Malformed;
+          }
+          break;
+        }
+        case binary_log::RecordType::Message: {
+          u8 level;
+          u8 hour;
+          u8 minute;
+          u8 second;
+          u32 microsecond;
+          u16 component_id;
+          u32 format_id;
+          u32 arguments_size;
+
+          if(!Read(level) || !Read(hour) || !Read(minute) || !Read(second) || !Read(microsecond) ||
+             !Read(component_id) || !Read(format_id) || !Read(arguments_size)) {
+            return Status::Malformed;
+          }
+
+          const bool valid_level = level == Trace || level == Debug || level == Info ||
+                                   level == Warn || level == Error || level == Fatal;
+
+          const bool valid_component = component_id == binary_log::k_no_component ||
+                                       (component_id < components.size() && components[component_id].has_value());
+
+          if(!valid_level || !valid_component || format_id >= formats.size() ||
+             arguments_size > binary_log::k_max_record_data_size) {
+            return Status::Malformed;
+          }
+
+          arguments.resize(arguments_size);
+          if(arguments_size > 0u && std::fread(arguments.data(), 1u, arguments_size, file) != arguments_size) {
+            return Status::Malformed;
+          }
+
+          text.clear();
+          try {
+            if(!detail::format_packed_arguments(text, formats[format_id], arguments)) {
+              return Status::Malformed;
+            }
+          } catch(fmt::format_error const&) {
+            return Status::Malformed;
+          }
+
+          message.level = (Level)level;
+          message.time = {hour, minute, second, (int)microsecond};
+          message.component = std::nullopt;
+          if(component_id != binary_log::k_no_component) {
+            message.component = components[component_id].value();
+          }
+          message.text = {text.data(), text.size()};
+          return Status::Ok;
+        }
+        default: {
+          return Status::Malformed;
+        }
+      }
+    }
+  }
+
+  template<typename T>
+  bool BinaryLogReader::Read(T& value) {
+    return std::fread(&value, sizeof(T), 1u, file) == 1u;
+  }
+
+  bool BinaryLogReader::ReadString(std::string& string, size_t length) {
+    string.resize(length);
+    return length == 0u || std::fread(string.data(), 1u, length, file) == length;
+  }
+
+} // namespace atom
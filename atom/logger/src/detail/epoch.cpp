@@ -0,0 +1,87 @@
+#include <atom/logger/detail/epoch.hpp>
+#include <atomic>
+
+namespace atom::detail {
+
+  namespace {
+
+    struct ThreadRecord {
+      std::atomic<u64> active_epoch{0}; ///< the epoch that the thread read in or zero if it is not reading
+      std::atomic_bool in_use{true};
+      ThreadRecord* next{nullptr};
+    };
+
+    constinit std::atomic<u64> g_epoch{1};
+
+    // Thread records are never freed. Records of threads that have exited are reused by new threads.
+    constinit std::atomic<ThreadRecord*> g_thread_records{nullptr};
+
+    ThreadRecord* acquire_thread_record() {
+      for(ThreadRecord* record = g_thread_records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        bool in_use = false;
+        if(!record->in_use.load(std::memory_order_relaxed) && record->in_use.compare_exchange_strong(in_use, true)) {
+          return record;
+        }
+      }
+
+      auto record = new ThreadRecord{};
+      ThreadRecord* head = g_thread_records.load(std::memory_order_relaxed);
+      do {
+        record->next = head;
+      } while(!g_thread_records.compare_exchange_weak(head, record));
+      return record;
+    }
+
+    struct ThreadState {
+      ThreadRecord* record = acquire_thread_record();
+      int depth = 0;
+
+     ~ThreadState() {
+        record->active_epoch.store(0u, std::memory_order_release);
+        record->in_use.store(false, std::memory_order_release);
+      }
+    };
+
+    thread_local ThreadState t_thread_state{};
+
+  } // anonymous namespace
+
+  void enter_epoch() {
+    ThreadState& state = t_thread_state;
+
+    if(state.depth++ == 0) {
+      // Sequentially consistent, so that a writer either sees this thread as active or
+      // this thread sees everything that the writer unpublished before advancing the epoch.
+      state.record->active_epoch.store(g_epoch.load());
+    }
+  }
+
+  void leave_epoch() {
+    ThreadState& state = t_thread_state;
+
+    if(--state.depth == 0) {
+      state.record->active_epoch.store(0u, std::memory_order_release);
+    }
+  }
+
+  u64 advance_epoch() {
+    return g_epoch.fetch_add(1u);
+  }
+
+  bool is_epoch_quiescent(u64 epoch) {
+    // Threads whose record is not in the list yet will read a later epoch than the one that is being checked.
+    for(ThreadRecord* record = g_thread_records.load(); record != nullptr; record = record->next) {
+      const u64 active_epoch = record->active_epoch.load();
+
+      if(active_epoch != 0u && active_epoch <= epoch) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool is_in_epoch() {
+    return t_thread_state.depth > 0;
+  }
+
+} // namespace atom::detail
@@ -1,25 +1,179 @@
 
+#include <atom/hash.hpp>
 #include <atom/logger/logger.hpp>
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <limits>
+#include <shared_mutex>
+#include <thread>
 #include <unordered_map>
 
 namespace atom {
 
+  namespace detail {
+
+    namespace {
+
+      /// The number of nested log messages per thread that can be formatted without allocating a new buffer
+      constexpr int k_staging_buffer_count = 4;
+
+      /// Buffers that have grown beyond this capacity (due to an unusually long message) are released again
+      constexpr size_t k_max_retained_staging_capacity = 64 * 1024;
+
+      struct StagingBuffers {
+        std::array<fmt::memory_buffer, k_staging_buffer_count> buffers;
+        int depth = 0;
+      };
+
+      thread_local StagingBuffers staging_buffers;
+
+    } // anonymous namespace
+
+    fmt::memory_buffer* acquire_staging_buffer() {
+      const int depth = staging_buffers.depth++;
+
+      if(depth >= k_staging_buffer_count) {
+        return new fmt::memory_buffer{};
+      }
+
+      fmt::memory_buffer* buffer = &staging_buffers.buffers[depth];
+      buffer->clear();
+      return buffer;
+    }
+
+    void release_staging_buffer(fmt::memory_buffer* buffer) {
+      const int depth = --staging_buffers.depth;
+
+      if(depth >= k_staging_buffer_count) {
+        delete buffer;
+      } else if(buffer->capacity() > k_max_retained_staging_capacity) {
+        *buffer = fmt::memory_buffer{};
+      }
+    }
+
+  } // namespace atom::detail
+
+  Logger::Message::Time Logger::GetCurrentTime() {
+    // Converting to local time is expensive and (in glibc) serialized by a global lock.
+    // The conversion result only changes once per second, so each thread caches the most recent one.
+    struct LocalTimeCache {
+      s64 epoch_second = std::numeric_limits<s64>::min();
+      int hour;
+      int minute;
+      int second;
+    };
+
+    thread_local LocalTimeCache cache{};
+
+    const s64 epoch_microsecond = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+
+    s64 epoch_second = epoch_microsecond / 1000000;
+    if(epoch_microsecond < 0 && epoch_second * 1000000 != epoch_microsecond) {
+      epoch_second--;
+    }
+
+    if(epoch_second != cache.epoch_second) {
+      const std::time_t time = (std::time_t)epoch_second;
+      std::tm local_time{};
+
+#if defined(WIN32)
+      localtime_s(&local_time, &time);
+#else
+      localtime_r(&time, &local_time);
+#endif
+
+      cache = {epoch_second, local_time.tm_hour, local_time.tm_min, local_time.tm_sec};
+    }
+
+    return {cache.hour, cache.minute, cache.second, (int)(epoch_microsecond - epoch_second * 1000000)};
+  }
+
+  Logger::SinkCollection::SinkCollection() : snapshot{new Snapshot{}} {}
+
+  Logger::SinkCollection::~SinkCollection() {
+    for(auto& retired : retired_snapshots) {
+      delete retired.snapshot;
+    }
+    delete snapshot.load();
+  }
+
+  void Logger::SinkCollection::Install(std::shared_ptr<SinkBase> const& sink) {
+    std::lock_guard lock{writer_mutex};
+
+    auto sinks = snapshot.load()->sinks;
+    sinks.push_back(sink);
+    Publish(std::move(sinks), false);
+  }
+
+  void Logger::SinkCollection::Remove(std::shared_ptr<SinkBase> const& sink) {
+    std::lock_guard lock{writer_mutex};
+
+    auto sinks = snapshot.load()->sinks;
+    sinks.erase(std::remove(sinks.begin(), sinks.end(), sink), sinks.end());
+    Publish(std::move(sinks), !detail::is_in_epoch());
+  }
+
+  std::vector<std::shared_ptr<Logger::SinkBase>> Logger::SinkCollection::GetSinks() const {
+    const detail::EpochReadSection read_section{};
+
+    return snapshot.load()->sinks;
+  }
+
+  void Logger::SinkCollection::Publish(std::vector<std::shared_ptr<SinkBase>> sinks, bool wait_for_readers) {
+    Snapshot const* old_snapshot = snapshot.exchange(new Snapshot{std::move(sinks)});
+    const u64 epoch = detail::advance_epoch();
+
+    retired_snapshots.push_back({old_snapshot, epoch});
+
+    if(wait_for_readers) {
+      while(!detail::is_epoch_quiescent(epoch)) {
+        std::this_thread::yield();
+      }
+    }
+
+    // Free the retired snapshots (and release their references to removed sinks) once no reader can access them anymore.
+    std::erase_if(retired_snapshots, [](RetiredSnapshot const& retired) {
+      if(detail::is_epoch_quiescent(retired.epoch)) {
+        delete retired.snapshot;
+        return true;
+      }
+      return false;
+    });
+  }
+
   Logger& get_logger() {
     static Logger logger{"atom"};
 
     return logger;
   }
 
-  Logger& get_named_logger(std::string const& name) {
-    static std::unordered_map<std::string, Logger> registry;
+  Logger& get_named_logger(std::string_view name) {
+    static std::shared_mutex mutex;
+    static std::unordered_map<std::string, Logger, StringHash, std::equal_to<>> registry;
+
+    {
+      std::shared_lock lock{mutex};
+
+      const auto match = registry.find(name);
+      if(match != registry.end()) {
+        return match->second;
+      }
+    }
+
+    std::unique_lock lock{mutex};
+
+    auto match = registry.find(name);
 
-    if (!registry.contains(name)) {
+    if(match == registry.end()) {
       auto sink_collection = std::make_shared<Logger::SinkCollection>();
       sink_collection->Install(get_logger().GetSinkCollection());
-      registry[name] = Logger{sink_collection, name};
+      match = registry.try_emplace(std::string{name}, sink_collection, name).first;
     }
 
-    return registry[name];
+    // References to the elements of an std::unordered_map remain valid when other elements are inserted.
+    return match->second;
   }
 
 } // namespace atom
\ No newline at end of file
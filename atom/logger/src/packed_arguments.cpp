@@ -0,0 +1,85 @@
+#include <atom/logger/packed_arguments.hpp>
+#include <fmt/args.h>
+#include <iterator>
+
+namespace atom::detail {
+
+  template<typename T>
+  static bool read_packed_value(std::span<const u8>& arguments, T& value) {
+    if(arguments.size() < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, arguments.data(), sizeof(T));
+    arguments = arguments.subspan(sizeof(T));
+    return true;
+  }
+
+  bool format_packed_arguments(fmt::memory_buffer& buffer, std::string_view format, std::span<const u8> arguments) {
+    // Reused between calls so that formatting does not allocate in the steady state.
+    // Only arithmetic values, pointers and string views are pushed, which the store does not copy.
+    thread_local fmt::dynamic_format_arg_store<fmt::format_context> store{};
+    store.clear();
+
+    while(!arguments.empty()) {
+      const auto type = (PackedArgumentType)arguments[0];
+      arguments = arguments.subspan(1);
+
+      const auto push_value = [&]<typename T>(T value) {
+        if(!read_packed_value(arguments, value)) {
+          return false;
+        }
+        store.push_back(value);
+        return true;
+      };
+
+      bool success;
+
+      switch(type) {
+        case PackedArgumentType::Bool: {
+          u8 value;
+          success = read_packed_value(arguments, value);
+          if(success) {
+            store.push_back(value != 0u);
+          }
+          break;
+        }
+        case PackedArgumentType::Char: success = push_value(char{}); break;
+        case PackedArgumentType::S32:  success = push_value(s32{}); break;
+        case PackedArgumentType::U32:  success = push_value(u32{}); break;
+        case PackedArgumentType::S64:  success = push_value(s64{}); break;
+        case PackedArgumentType::U64:  success = push_value(u64{}); break;
+        case PackedArgumentType::F32:  success = push_value(float{}); break;
+        case PackedArgumentType::F64:  success = push_value(double{}); break;
+        case PackedArgumentType::Pointer: {
+          u64 value;
+          success = read_packed_value(arguments, value);
+          if(success) {
+            store.push_back(reinterpret_cast<const void*>((std::uintptr_t)value));
+          }
+          break;
+        }
+        case PackedArgumentType::String: {
+          u32 length;
+          success = read_packed_value(arguments, length) && arguments.size() >= length;
+          if(success) {
+            store.push_back(std::string_view{(const char*)arguments.data(), length});
+            arguments = arguments.subspan(length);
+          }
+          break;
+        }
+        default: {
+          success = false;
+          break;
+        }
+      }
+
+      if(!success) {
+        return false;
+      }
+    }
+
+    fmt::vformat_to(std::back_inserter(buffer), format, store);
+    return true;
+  }
+
+} // namespace atom::detail
@@ -0,0 +1,84 @@
+#include <atom/logger/rate_limit.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace atom {
+
+  namespace detail {
+
+    namespace {
+
+      struct SuppressedMessageCounterRegistry {
+        std::mutex mutex;
+        std::vector<SuppressedMessageCounter*> counters;
+      };
+
+      /// Allows {@link #report_suppressed_messages} to return early (without creating the registry) if no call site suppressed messages yet.
+      std::atomic<bool> has_suppressed_message_counters{false};
+
+      SuppressedMessageCounterRegistry& get_suppressed_message_counter_registry() {
+        // Intentionally leaked, so that call sites can still report during exit.
+        static SuppressedMessageCounterRegistry* registry = [] {
+          // The default logger must be created before the exit handler is registered, so that it is destroyed after the handler ran.
+          (void)get_logger();
+          std::atexit([] { get_logger().Flush(); });
+          return new SuppressedMessageCounterRegistry{};
+        }();
+        return *registry;
+      }
+
+      template<Level level>
+      void report_suppressed_message_count(u64 count, const char* file, u32 line) {
+        get_logger().Log<level>("suppressed {} messages from {}:{}", count, file, line);
+      }
+
+    } // anonymous namespace
+
+    void register_suppressed_message_counter(SuppressedMessageCounter* counter) {
+      SuppressedMessageCounterRegistry& registry = get_suppressed_message_counter_registry();
+      std::lock_guard lock{registry.mutex};
+      registry.counters.push_back(counter);
+      has_suppressed_message_counters.store(true, std::memory_order_release);
+    }
+
+  } // namespace atom::detail
+
+  void report_suppressed_messages() {
+    if(!detail::has_suppressed_message_counters.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    struct PendingReport {
+      detail::SuppressedMessageCounter* counter;
+      u64 count;
+    };
+
+    std::vector<PendingReport> reports{};
+
+    {
+      detail::SuppressedMessageCounterRegistry& registry = detail::get_suppressed_message_counter_registry();
+      std::lock_guard lock{registry.mutex};
+
+      for(detail::SuppressedMessageCounter* counter : registry.counters) {
+        if(const u64 count = counter->Take(); count > 0u) {
+          reports.push_back({counter, count});
+        }
+      }
+    }
+
+    // Log without holding the lock, in case a sink logs through a rate limited call site itself.
+    for(const auto& [counter, count] : reports) {
+      switch(counter->GetLevel()) {
+        case Trace: detail::report_suppressed_message_count<Trace>(count, counter->GetFile(), counter->GetLine()); break;
+        case Debug: detail::report_suppressed_message_count<Debug>(count, counter->GetFile(), counter->GetLine()); break;
+        case Info:  detail::report_suppressed_message_count<Info>(count, counter->GetFile(), counter->GetLine()); break;
+        case Warn:  detail::report_suppressed_message_count<Warn>(count, counter->GetFile(), counter->GetLine()); break;
+        case Error: detail::report_suppressed_message_count<Error>(count, counter->GetFile(), counter->GetLine()); break;
+        default:    detail::report_suppressed_message_count<Fatal>(count, counter->GetFile(), counter->GetLine()); break;
+      }
+    }
+  }
+
+} // namespace atom
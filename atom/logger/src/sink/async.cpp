@@ -0,0 +1,362 @@
+#include <atom/crash.hpp>
+#include <atom/logger/sink/async.hpp>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <variant>
+
+namespace atom {
+
+  LoggerAsyncSink::LoggerAsyncSink(
+    std::shared_ptr<SinkBase> target,
+    size_t capacity,
+    OverflowPolicy overflow_policy
+  )   : target{std::move(target)}
+      , overflow_policy{overflow_policy} {
+    const size_t slot_count = std::bit_ceil(std::max<size_t>(capacity, 2u));
+
+    slots = std::make_unique<Slot[]>(slot_count);
+    slot_mask = slot_count - 1u;
+
+    for(size_t i = 0; i < slot_count; i++) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    batch.reserve(k_batch_size);
+
+    backend_thread = std::thread{[this]() { RunBackend(); }};
+    crash_hook = register_crash_hook(&EmergencyFlush, this);
+  }
+
+  LoggerAsyncSink::~LoggerAsyncSink() {
+    unregister_crash_hook(crash_hook);
+    stop.store(true, std::memory_order_release);
+    WakeBackend();
+    backend_thread.join();
+    target->Flush();
+  }
+
+  void LoggerAsyncSink::Flush() {
+    const u64 ticket = RequestFlush();
+
+    u64 current_flushed_count = flushed_count.load(std::memory_order_acquire);
+    while(current_flushed_count < ticket) {
+      flushed_count.wait(current_flushed_count, std::memory_order_acquire);
+      current_flushed_count = flushed_count.load(std::memory_order_acquire);
+    }
+  }
+
+  u64 LoggerAsyncSink::RequestFlush() {
+    const u64 ticket = enqueue_position.load(std::memory_order_acquire);
+
+    u64 request = flush_request.load(std::memory_order_relaxed);
+    while(request < ticket && !flush_request.compare_exchange_weak(request, ticket, std::memory_order_release)) {
+    }
+
+    WakeBackend();
+    return ticket;
+  }
+
+  void LoggerAsyncSink::EmergencyFlush(void* user_data) {
+    auto sink = (LoggerAsyncSink*)user_data;
+
+    // Nothing can be done if the backend thread itself has crashed.
+    if(std::this_thread::get_id() == sink->backend_thread.get_id()) {
+      return;
+    }
+
+    // Wait for the backend thread with a timeout, since a message may have been claimed by the crashed thread
+    // and never be published.
+    const u64 ticket = sink->RequestFlush();
+
+    for(int i = 0; i < k_crash_flush_timeout_ms; i++) {
+      if(sink->flushed_count.load(std::memory_order_acquire) >= ticket) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  }
+
+  void LoggerAsyncSink::AppendImpl(Logger::Message const& message) {
+    Enqueue([&](Slot& slot) {
+      slot.level = message.level;
+      slot.time = message.time;
+      slot.has_component = message.component.has_value();
+      if(slot.has_component) {
+        slot.component.assign(message.component.value());
+      }
+      slot.deferred = false;
+      slot.text.assign(message.text);
+      CopyFields(slot, message.fields);
+    });
+  }
+
+  void LoggerAsyncSink::AppendDeferredImpl(Logger::DeferredMessage const& message) {
+    Enqueue([&](Slot& slot) {
+      slot.level = message.level;
+      slot.time = message.time;
+      slot.has_component = message.component.has_value();
+      if(slot.has_component) {
+        slot.component.assign(message.component.value());
+      }
+      slot.deferred = true;
+      slot.format = message.format;
+      slot.arguments_size = message.arguments.size();
+      std::copy(message.arguments.begin(), message.arguments.end(), slot.arguments.begin());
+      slot.field_count = 0u;
+    });
+  }
+
+  void LoggerAsyncSink::CopyFields(Slot& slot, std::span<const Logger::Field> fields) {
+    const size_t field_count = std::min(fields.size(), k_max_fields);
+
+    const auto get_string_value = [](Logger::Field const& field) {
+      const auto string_value = std::get_if<std::string_view>(&field.value);
+      return string_value != nullptr ? *string_value : std::string_view{};
+    };
+
+    size_t string_size = 0u;
+    for(size_t i = 0; i < field_count; i++) {
+      string_size += fields[i].key.size() + get_string_value(fields[i]).size();
+    }
+
+    // Size the storage up front, so that the fields can reference it without being invalidated by reallocation.
+    slot.field_strings.resize(string_size);
+
+    char* storage = slot.field_strings.data();
+
+    const auto copy_string = [&](std::string_view string) {
+      const std::string_view copy{storage, string.size()};
+      std::copy(string.begin(), string.end(), storage);
+      storage += string.size();
+      return copy;
+    };
+
+    for(size_t i = 0; i < field_count; i++) {
+      Logger::Field& field = slot.fields[i];
+
+      field.key = copy_string(fields[i].key);
+
+      if(std::holds_alternative<std::string_view>(fields[i].value)) {
+        field.value = copy_string(get_string_value(fields[i]));
+      } else {
+        field.value = fields[i].value;
+      }
+    }
+
+    slot.field_count = field_count;
+  }
+
+  template<typename WriteSlot>
+  void LoggerAsyncSink::Enqueue(WriteSlot&& write_slot) {
+    switch(overflow_policy) {
+      case OverflowPolicy::Block: {
+        while(!TryEnqueue(write_slot)) {
+          std::this_thread::yield();
+        }
+        break;
+      }
+      case OverflowPolicy::DropNewest: {
+        if(!TryEnqueue(write_slot)) {
+          dropped_count.fetch_add(1u, std::memory_order_relaxed);
+          return;
+        }
+        break;
+      }
+      case OverflowPolicy::DropOldest: {
+        while(!TryEnqueue(write_slot)) {
+          TryDropOldest();
+        }
+        break;
+      }
+    }
+
+    WakeBackend();
+  }
+
+  template<typename WriteSlot>
+  bool LoggerAsyncSink::TryEnqueue(WriteSlot&& write_slot) {
+    u64 position = enqueue_position.load(std::memory_order_relaxed);
+
+    while(true) {
+      Slot& slot = slots[position & slot_mask];
+      const u64 sequence = slot.sequence.load(std::memory_order_acquire);
+      const s64 difference = (s64)sequence - (s64)position;
+
+      if(difference == 0) {
+        if(enqueue_position.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed)) {
+          write_slot(slot);
+          slot.sequence.store(position + 1u, std::memory_order_release);
+          return true;
+        }
+      } else if(difference < 0) {
+        return false; // the ring buffer is full
+      } else {
+        position = enqueue_position.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool LoggerAsyncSink::TryClaim(u64& position, Slot*& slot) {
+    position = dequeue_position.load(std::memory_order_relaxed);
+
+    while(true) {
+      slot = &slots[position & slot_mask];
+      const u64 sequence = slot->sequence.load(std::memory_order_acquire);
+      const s64 difference = (s64)sequence - (s64)(position + 1u);
+
+      if(difference == 0) {
+        if(dequeue_position.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed)) {
+          return true;
+        }
+      } else if(difference < 0) {
+        return false; // the ring buffer is empty
+      } else {
+        position = dequeue_position.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void LoggerAsyncSink::Release(u64 position, Slot& slot) {
+    slot.sequence.store(position + slot_mask + 1u, std::memory_order_release);
+    completed_count.fetch_add(1u, std::memory_order_release);
+  }
+
+  bool LoggerAsyncSink::TryDropOldest() {
+    u64 position;
+    Slot* slot;
+
+    if(!TryClaim(position, slot)) {
+      return false;
+    }
+    dropped_count.fetch_add(1u, std::memory_order_relaxed);
+    Release(position, *slot);
+    return true;
+  }
+
+  size_t LoggerAsyncSink::ForwardBatch() {
+    std::array<u64, k_batch_size> positions;
+    std::array<Slot*, k_batch_size> claimed_slots;
+
+    size_t count = 0;
+    while(count < k_batch_size && TryClaim(positions[count], claimed_slots[count])) {
+      count++;
+    }
+
+    if(count == 0) {
+      return 0;
+    }
+
+    const bool target_accepts_deferred = target->AcceptsDeferred();
+
+    // The claimed slots stay untouched by other threads until they are released,
+    // so the batched messages may reference their contents directly.
+    batch.clear();
+
+    for(size_t i = 0; i < count; i++) {
+      Slot& slot = *claimed_slots[i];
+
+      std::optional<std::string_view> component;
+      if(slot.has_component) {
+        component = slot.component;
+      }
+
+      if(slot.deferred) {
+        const std::span<const u8> arguments{slot.arguments.data(), slot.arguments_size};
+        const Logger::DeferredMessage message{slot.level, slot.time, component, slot.format, arguments};
+
+        if(target_accepts_deferred) {
+          // Preserve the order of messages.
+          target->AppendBatch(batch);
+          batch.clear();
+          target->AppendDeferred(message);
+          continue;
+        }
+
+        format_buffer.clear();
+        message.FormatTo(format_buffer);
+        slot.text.assign(format_buffer.data(), format_buffer.size());
+      }
+
+      batch.push_back({slot.level, slot.time, component, slot.text, {slot.fields.data(), slot.field_count}});
+    }
+
+    if(!batch.empty()) {
+      target->AppendBatch(batch);
+    }
+
+    for(size_t i = 0; i < count; i++) {
+      Release(positions[i], *claimed_slots[i]);
+    }
+
+    return count;
+  }
+
+  bool LoggerAsyncSink::IsEmpty() const {
+    return dequeue_position.load() == enqueue_position.load();
+  }
+
+  void LoggerAsyncSink::WakeBackend() {
+    // Pairs with the store to backend_sleeping in RunBackend(): either the backend thread observes
+    // the new state before going to sleep or we observe that it is sleeping and wake it up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if(backend_sleeping.load(std::memory_order_relaxed)) {
+      wakeup_counter.fetch_add(1u, std::memory_order_release);
+      wakeup_counter.notify_one();
+    }
+  }
+
+  void LoggerAsyncSink::RunBackend() {
+    int idle_count = 0;
+
+    while(true) {
+      const size_t count = ForwardBatch();
+
+      const u64 requested_count = flush_request.load(std::memory_order_acquire);
+
+      if(requested_count > flushed_count.load(std::memory_order_relaxed)) {
+        const u64 current_completed_count = completed_count.load(std::memory_order_acquire);
+
+        if(current_completed_count >= requested_count) {
+          target->Flush();
+          flushed_count.store(current_completed_count, std::memory_order_release);
+          flushed_count.notify_all();
+        } else if(count == 0) {
+          // A message that precedes the flush request has been claimed but not yet been published.
+          std::this_thread::yield();
+          continue;
+        }
+      }
+
+      if(count > 0) {
+        idle_count = 0;
+        continue;
+      }
+
+      if(stop.load(std::memory_order_acquire)) {
+        if(IsEmpty()) {
+          break;
+        }
+        continue;
+      }
+
+      if(++idle_count < k_spin_count) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      const u32 current_wakeup_counter = wakeup_counter.load(std::memory_order_acquire);
+
+      backend_sleeping.store(true);
+
+      if(IsEmpty() && !stop.load() && flush_request.load() <= flushed_count.load()) {
+        wakeup_counter.wait(current_wakeup_counter, std::memory_order_acquire);
+      }
+
+      backend_sleeping.store(false, std::memory_order_relaxed);
+      idle_count = 0;
+    }
+  }
+
+} // namespace atom
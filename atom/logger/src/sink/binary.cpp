@@ -0,0 +1,129 @@
+#include <atom/logger/sink/binary.hpp>
+#include <atom/panic.hpp>
+#include <limits>
+
+namespace atom {
+
+  // Plain text messages are stored as this format string and the message text as the only argument.
+  static constexpr std::string_view k_text_format = "{}";
+
+  LoggerBinarySink::LoggerBinarySink(std::string const& path) {
+    file = std::fopen(path.c_str(), "wb");
+
+    if(file == nullptr) {
+      ATOM_PANIC("Could not open log file: {}", path);
+    }
+
+    std::fwrite(binary_log::k_signature.data(), 1u, binary_log::k_signature.size(), file);
+    std::fwrite(&binary_log::k_version, 1u, 1u, file);
+  }
+
+  LoggerBinarySink::~LoggerBinarySink() {
+    std::fclose(file);
+  }
+
+  void LoggerBinarySink::Flush() {
+    std::fflush(file);
+  }
+
+  void LoggerBinarySink::AppendImpl(Logger::Message const& message) {
+    // Keep the packed text within the record size limit of the reader.
+    constexpr size_t max_text_length = binary_log::k_max_record_data_size - sizeof(PackedArgumentType) - sizeof(u32);
+
+    const std::string_view text = message.text.substr(0u, max_text_length);
+    const size_t size = detail::get_packed_size(text);
+
+    arguments_buffer.resize(size);
+    detail::pack_arguments((u8*)arguments_buffer.data(), text);
+
+    WriteMessage(
+      message.level, message.time, message.component, k_text_format, {(const u8*)arguments_buffer.data(), size});
+  }
+
+  void LoggerBinarySink::AppendDeferredImpl(Logger::DeferredMessage const& message) {
+    WriteMessage(message.level, message.time, message.component, message.format, message.arguments);
+  }
+
+  size_t LoggerBinarySink::FormatKeyHash::operator()(std::pair<const char*, size_t> const& key) const {
+    size_t hash = 0u;
+    hash_combine(hash, key.first);
+    hash_combine(hash, key.second);
+    return hash;
+  }
+
+  u16 LoggerBinarySink::GetComponentID(std::optional<std::string_view> component) {
+    if(!component.has_value()) {
+      return binary_log::k_no_component;
+    }
+
+    const auto match = component_ids.find(component.value());
+
+    if(match != component_ids.end()) {
+      return match->second;
+    }
+
+    if(component_ids.size() >= binary_log::k_no_component) {
+      ATOM_PANIC("binary log: too many distinct components");
+    }
+
+    const u16 id = (u16)component_ids.size();
+    const u16 length = (u16)std::min<size_t>(component->size(), std::numeric_limits<u16>::max());
+
+    component_ids.emplace(component.value(), id);
+
+    Write(binary_log::RecordType::DefineComponent);
+    Write(id);
+    Write(length);
+    record_buffer.append(component->data(), component->data() + length);
+    return id;
+  }
+
+  u32 LoggerBinarySink::GetFormatID(std::string_view format) {
+    // Format strings have static storage duration, so their address identifies them.
+    const std::pair<const char*, size_t> key{format.data(), format.size()};
+
+    const auto match = format_ids.find(key);
+
+    if(match != format_ids.end()) {
+      return match->second;
+    }
+
+    const u32 id = (u32)format_ids.size();
+
+    format_ids.emplace(key, id);
+
+    Write(binary_log::RecordType::DefineFormat);
+    Write(id);
+    Write((u32)format.size());
+    record_buffer.append(format);
+    return id;
+  }
+
+  void LoggerBinarySink::WriteMessage(
+    Level level,
+    Logger::Message::Time const& time,
+    std::optional<std::string_view> component,
+    std::string_view format,
+    std::span<const u8> arguments
+  ) {
+    record_buffer.clear();
+
+    // Definition records for new components and format strings precede the message record.
+    const u16 component_id = GetComponentID(component);
+    const u32 format_id = GetFormatID(format);
+
+    Write(binary_log::RecordType::Message);
+    Write((u8)level);
+    Write((u8)time.hour);
+    Write((u8)time.minute);
+    Write((u8)time.second);
+    Write((u32)time.microsecond);
+    Write(component_id);
+    Write(format_id);
+    Write((u32)arguments.size());
+    record_buffer.append((const char*)arguments.data(), (const char*)arguments.data() + arguments.size());
+
+    std::fwrite(record_buffer.data(), 1u, record_buffer.size(), file);
+  }
+
+} // namespace atom
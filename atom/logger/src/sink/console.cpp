@@ -1,11 +1,36 @@
-
 #include <atom/logger/sink/console.hpp>
+#include <cstdio>
 #include <fmt/color.h>
+#include <iterator>
+
+#include "format.hpp"
 
 namespace atom {
 
   void LoggerConsoleSink::AppendImpl(Logger::Message const& message) {
-    const auto [level, time, component, text] = message;
+    detail::StagingBuffer buffer{};
+    FormatTo(buffer.Get(), message);
+    std::fwrite(buffer.Get().data(), 1u, buffer.Get().size(), stdout);
+  }
+
+  void LoggerConsoleSink::AppendBatchImpl(std::span<const Logger::Message> messages) {
+    detail::StagingBuffer buffer{};
+
+    for(auto const& message : messages) {
+      if(GetLogLevelEnable(message.level)) {
+        FormatTo(buffer.Get(), message);
+      }
+    }
+
+    std::fwrite(buffer.Get().data(), 1u, buffer.Get().size(), stdout);
+  }
+
+  void LoggerConsoleSink::Flush() {
+    std::fflush(stdout);
+  }
+
+  void LoggerConsoleSink::FormatTo(fmt::memory_buffer& buffer, Logger::Message const& message) {
+    const auto [level, time, component, text, fields] = message;
 
     fmt::text_style text_style{};
 
@@ -17,19 +42,12 @@ namespace atom {
       default: break;
     }
 
-    const char* level_str = "?";
+    const char* level_str = detail::get_level_string(level);
 
-    switch (level) {
-      case Trace: level_str = "T"; break;
-      case Debug: level_str = "D"; break;
-      case Info:  level_str = "I"; break;
-      case Warn:  level_str = "W"; break;
-      case Error: level_str = "E"; break;
-      case Fatal: level_str = "F"; break;
-      default: break;
-    }
+    fmt::memory_buffer field_buffer;
+    detail::format_fields(field_buffer, fields);
 
-    fmt::print(text_style, "[{}] [{:02}:{:02}:{:02}] ({})\t {}\n", level_str, time.hour, time.minute, time.second, component.value_or("Unknown"), text);
+    fmt::format_to(std::back_inserter(buffer), text_style, "[{}] [{:02}:{:02}:{:02}] ({})\t {}{}\n", level_str, time.hour, time.minute, time.second, component.value_or("Unknown"), text, fmt::string_view{field_buffer.data(), field_buffer.size()});
   }
 
-} // namespace atom
\ No newline at end of file
+} // namespace atom
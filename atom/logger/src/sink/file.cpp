@@ -2,6 +2,8 @@
 #include <atom/logger/sink/file.hpp>
 #include <atom/panic.hpp>
 
+#include "format.hpp"
+
 namespace atom {
 
   LoggerFileSink::LoggerFileSink(std::string const& path) {
@@ -12,26 +14,37 @@ namespace atom {
     }
   }
 
+  LoggerFileSink::LoggerFileSink(std::FILE* file) : file{file}, owns_file{false} {
+  }
+
   LoggerFileSink::~LoggerFileSink() {
-    std::fclose(file);
+    if(owns_file) {
+      std::fclose(file);
+    } else {
+      std::fflush(file);
+    }
+  }
+
+  void LoggerFileSink::Flush() {
+    std::fflush(file);
   }
 
   void LoggerFileSink::AppendImpl(Logger::Message const& message) {
-    const auto [level, time, component, text] = message;
-
-    const char* level_str = "?";
-
-    switch (level) {
-      case Trace: level_str = "T"; break;
-      case Debug: level_str = "D"; break;
-      case Info:  level_str = "I"; break;
-      case Warn:  level_str = "W"; break;
-      case Error: level_str = "E"; break;
-      case Fatal: level_str = "F"; break;
-      default: break;
+    detail::StagingBuffer buffer{};
+    detail::format_line(buffer.Get(), message);
+    std::fwrite(buffer.Get().data(), 1u, buffer.Get().size(), file);
+  }
+
+  void LoggerFileSink::AppendBatchImpl(std::span<const Logger::Message> messages) {
+    detail::StagingBuffer buffer{};
+
+    for(auto const& message : messages) {
+      if(GetLogLevelEnable(message.level)) {
+        detail::format_line(buffer.Get(), message);
+      }
     }
 
-    fmt::print(file, "[{}] [{:02}:{:02}:{:02}] ({})\t {}\n", level_str, time.hour, time.minute, time.second, component.value_or("Unknown"), text);
+    std::fwrite(buffer.Get().data(), 1u, buffer.Get().size(), file);
   }
 
 } // namespace atom
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atom/logger/logger.hpp>
+#include <fmt/format.h>
+#include <iterator>
+#include <span>
+#include <variant>
+
+namespace atom::detail {
+
+  /// @returns the single-letter abbreviation of a log level
+  inline const char* get_level_string(Level level) {
+    switch(level) {
+      case Trace: return "T";
+      case Debug: return "D";
+      case Info:  return "I";
+      case Warn:  return "W";
+      case Error: return "E";
+      case Fatal: return "F";
+      default: return "?";
+    }
+  }
+
+  /// Append the fields of a message to a buffer as space-separated `key=value` pairs, each preceded by a space
+  inline void format_fields(fmt::memory_buffer& buffer, std::span<const Logger::Field> fields) {
+    for(auto const& field : fields) {
+      std::visit([&](auto const& value) {
+        fmt::format_to(std::back_inserter(buffer), " {}={}", field.key, value);
+      }, field.value);
+    }
+  }
+
+  /// Append a message to a buffer, using the same line layout as {@link #LoggerFileSink}
+  inline void format_line(fmt::memory_buffer& buffer, Logger::Message const& message) {
+    const auto [level, time, component, text, fields] = message;
+
+    fmt::format_to(
+      std::back_inserter(buffer), "[{}] [{:02}:{:02}:{:02}] ({})\t {}",
+      get_level_string(level), time.hour, time.minute, time.second, component.value_or("Unknown"), text);
+
+    format_fields(buffer, fields);
+    buffer.push_back('\n');
+  }
+
+} // namespace atom::detail
@@ -0,0 +1,118 @@
+#include <atom/logger/sink/json.hpp>
+#include <atom/panic.hpp>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <variant>
+
+namespace atom {
+
+  namespace {
+
+    const char* get_level_name(Level level) {
+      switch(level) {
+        case Trace: return "trace";
+        case Debug: return "debug";
+        case Info:  return "info";
+        case Warn:  return "warn";
+        case Error: return "error";
+        case Fatal: return "fatal";
+        default: return "unknown";
+      }
+    }
+
+    /// Append a string to a buffer as a quoted and escaped JSON string
+    void append_string(fmt::memory_buffer& buffer, std::string_view string) {
+      buffer.push_back('"');
+
+      for(const char character : string) {
+        switch(character) {
+          case '"':  buffer.append(std::string_view{"\\\""}); break;
+          case '\\': buffer.append(std::string_view{"\\\\"}); break;
+          case '\n': buffer.append(std::string_view{"\\n"}); break;
+          case '\r': buffer.append(std::string_view{"\\r"}); break;
+          case '\t': buffer.append(std::string_view{"\\t"}); break;
+          default: {
+            if((unsigned char)character < 0x20u) {
+              fmt::format_to(std::back_inserter(buffer), "\\u{:04x}", (unsigned)character);
+            } else {
+              buffer.push_back(character);
+            }
+            break;
+          }
+        }
+      }
+
+      buffer.push_back('"');
+    }
+
+  } // anonymous namespace
+
+  LoggerJsonSink::LoggerJsonSink(std::string const& path) {
+    file = std::fopen(path.c_str(), "w");
+
+    if (file == nullptr) {
+      ATOM_PANIC("Could not open log file: {}", path);
+    }
+  }
+
+  LoggerJsonSink::~LoggerJsonSink() {
+    std::fclose(file);
+  }
+
+  void LoggerJsonSink::Flush() {
+    std::fflush(file);
+  }
+
+  void LoggerJsonSink::AppendImpl(Logger::Message const& message) {
+    const auto [level, time, component, text, fields] = message;
+
+    detail::StagingBuffer staging_buffer{};
+    fmt::memory_buffer& buffer = staging_buffer.Get();
+
+    fmt::format_to(
+      std::back_inserter(buffer), "{{\"level\":\"{}\",\"time\":\"{:02}:{:02}:{:02}.{:06}\",\"component\":",
+      get_level_name(level), time.hour, time.minute, time.second, time.microsecond);
+
+    if(component.has_value()) {
+      append_string(buffer, component.value());
+    } else {
+      buffer.append(std::string_view{"null"});
+    }
+
+    buffer.append(std::string_view{",\"message\":"});
+    append_string(buffer, text);
+
+    for(size_t i = 0; i < fields.size(); i++) {
+      auto const& field = fields[i];
+
+      buffer.append(std::string_view{i == 0u ? ",\"fields\":{" : ","});
+      append_string(buffer, field.key);
+      buffer.push_back(':');
+
+      std::visit([&](auto const& value) {
+        using T = std::decay_t<decltype(value)>;
+
+        if constexpr(std::is_same_v<T, std::string_view>) {
+          append_string(buffer, value);
+        } else if constexpr(std::is_same_v<T, double>) {
+          if(std::isfinite(value)) {
+            fmt::format_to(std::back_inserter(buffer), "{}", value);
+          } else {
+            buffer.append(std::string_view{"null"});
+          }
+        } else {
+          fmt::format_to(std::back_inserter(buffer), "{}", value);
+        }
+      }, field.value);
+    }
+
+    if(!fields.empty()) {
+      buffer.push_back('}');
+    }
+    buffer.append(std::string_view{"}\n"});
+
+    std::fwrite(buffer.data(), 1u, buffer.size(), file);
+  }
+
+} // namespace atom
@@ -0,0 +1,93 @@
+#include <atom/logger/sink/mapped_file.hpp>
+#include <atom/panic.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "format.hpp"
+
+namespace atom {
+
+  LoggerMappedFileSink::LoggerMappedFileSink(std::string const& path, size_t chunk_size) : path{path} {
+    const size_t page_size = (size_t)::sysconf(_SC_PAGESIZE);
+
+    this->chunk_size = std::max((chunk_size + page_size - 1u) & ~(page_size - 1u), page_size);
+
+    file_descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if(file_descriptor == -1) {
+      ATOM_PANIC("Could not open log file: {}", path);
+    }
+
+    Grow(this->chunk_size);
+  }
+
+  LoggerMappedFileSink::~LoggerMappedFileSink() {
+    ::munmap(data, capacity);
+    // Cut off the preallocated, but unused space at the end of the file.
+    (void)::ftruncate(file_descriptor, (off_t)size);
+    ::close(file_descriptor);
+  }
+
+  void LoggerMappedFileSink::Flush() {
+    ::msync(data, capacity, MS_ASYNC);
+  }
+
+  void LoggerMappedFileSink::AppendImpl(Logger::Message const& message) {
+    line_buffer.clear();
+    detail::format_line(line_buffer, message);
+
+    const size_t line_size = line_buffer.size();
+
+    if(size + line_size > capacity) {
+      Grow(size + line_size);
+    }
+
+    std::memcpy(data + size, line_buffer.data(), line_size);
+    size += line_size;
+  }
+
+  void LoggerMappedFileSink::Grow(size_t minimum_capacity) {
+    const size_t chunk_count = (minimum_capacity + chunk_size - 1u) / chunk_size;
+    const size_t new_capacity = chunk_count * chunk_size;
+
+    // Allocate the blocks up front: writing to a sparse mapping raises SIGBUS once the disk is full.
+    bool reserved = false;
+#if !defined(__APPLE__)
+    const int result = ::posix_fallocate(file_descriptor, (off_t)capacity, (off_t)(new_capacity - capacity));
+    if(result != 0 && result != EINVAL && result != EOPNOTSUPP) {
+      ATOM_PANIC("Could not grow log file: {} ({})", path, std::strerror(result));
+    }
+    reserved = result == 0;
+#endif
+
+    // Fall back to a sparse file on file systems that do not support fallocate.
+    if(!reserved && ::ftruncate(file_descriptor, (off_t)new_capacity) != 0) {
+      ATOM_PANIC("Could not grow log file: {}", path);
+    }
+
+    void* new_data;
+
+    if(data == nullptr) {
+      new_data = ::mmap(nullptr, new_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+    } else {
+#if defined(__linux__)
+      new_data = ::mremap(data, capacity, new_capacity, MREMAP_MAYMOVE);
+#else
+      ::munmap(data, capacity);
+      new_data = ::mmap(nullptr, new_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+#endif
+    }
+
+    if(new_data == MAP_FAILED) {
+      ATOM_PANIC("Could not map log file: {}", path);
+    }
+
+    data = (u8*)new_data;
+    capacity = new_capacity;
+  }
+
+} // namespace atom
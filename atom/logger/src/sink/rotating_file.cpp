@@ -0,0 +1,206 @@
+#include <atom/crash.hpp>
+#include <atom/logger/sink/rotating_file.hpp>
+#include <atom/panic.hpp>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "format.hpp"
+
+namespace atom {
+
+  namespace {
+
+    /// Claims the buffer of a sink, unless the crash hook claimed it already (@see LoggerRotatingFileSink::EmergencyFlush).
+    class BufferClaim {
+      public:
+        explicit BufferClaim(std::atomic<bool>& writing)
+            : writing{writing}
+            , claimed{!writing.exchange(true, std::memory_order_acquire)} {
+        }
+
+       ~BufferClaim() {
+          if(claimed) {
+            writing.store(false, std::memory_order_release);
+          }
+        }
+
+        explicit operator bool() const {
+          return claimed;
+        }
+
+      private:
+        std::atomic<bool>& writing;
+        bool claimed;
+    };
+
+  } // anonymous namespace
+
+  LoggerRotatingFileSink::LoggerRotatingFileSink(std::string path)
+      : LoggerRotatingFileSink{std::move(path), Options{}} {
+  }
+
+  LoggerRotatingFileSink::LoggerRotatingFileSink(std::string path, Options const& options)
+      : path{std::move(path)}
+      , options{options} {
+    buffer.reserve(options.buffer_size);
+    OpenFile();
+    crash_hook = register_crash_hook(&EmergencyFlush, this);
+  }
+
+  LoggerRotatingFileSink::~LoggerRotatingFileSink() {
+    unregister_crash_hook(crash_hook);
+    CloseFile();
+  }
+
+  void LoggerRotatingFileSink::Flush() {
+    if(BufferClaim claim{writing}) {
+      WriteBuffer();
+    }
+  }
+
+  void LoggerRotatingFileSink::AppendImpl(Logger::Message const& message) {
+    // The program is crashing and the crash hook writes out the buffer.
+    BufferClaim claim{writing};
+    if(!claim) {
+      return;
+    }
+
+    line_buffer.clear();
+    detail::format_line(line_buffer, message);
+
+    const Clock::time_point now = Clock::now();
+
+    const bool exceeds_size = options.max_file_size != 0u && file_size != 0u &&
+      file_size + line_buffer.size() > options.max_file_size;
+
+    const bool exceeds_age = options.max_file_age.count() != 0 &&
+      now - file_open_time >= options.max_file_age;
+
+    if(exceeds_size || exceeds_age) {
+      Rotate();
+    }
+
+    if(buffer.size() + line_buffer.size() > options.buffer_size) {
+      WriteBuffer();
+    }
+
+    buffer.append(line_buffer);
+    file_size += line_buffer.size();
+
+    // The process is likely to terminate after a fatal message, so it is written out regardless of the fsync policy.
+    if(message.level == Fatal) {
+      WriteBuffer();
+    }
+
+    switch(options.fsync_policy) {
+      case FsyncPolicy::Never: {
+        break;
+      }
+      case FsyncPolicy::OnError: {
+        if(message.level == Error || message.level == Fatal) {
+          Sync();
+        }
+        break;
+      }
+      case FsyncPolicy::Periodic: {
+        if(now - last_sync_time >= options.fsync_interval) {
+          Sync();
+        }
+        break;
+      }
+    }
+  }
+
+  void LoggerRotatingFileSink::OpenFile() {
+    file_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    if(file_descriptor == -1) {
+      ATOM_PANIC("Could not open log file: {}", path);
+    }
+
+    struct stat file_status{};
+    file_size = ::fstat(file_descriptor, &file_status) == 0 ? (size_t)file_status.st_size : 0u;
+    file_open_time = Clock::now();
+    last_sync_time = file_open_time;
+  }
+
+  void LoggerRotatingFileSink::CloseFile() {
+    WriteBuffer();
+
+    if(options.fsync_policy != FsyncPolicy::Never && ::fsync(file_descriptor) != 0) {
+      error_count++;
+    }
+
+    ::close(file_descriptor);
+    file_descriptor = -1;
+  }
+
+  void LoggerRotatingFileSink::Rotate() {
+    CloseFile();
+
+    if(options.max_retained_files > 0) {
+      for(int i = options.max_retained_files - 1; i >= 1; i--) {
+        const std::string source = fmt::format("{}.{}", path, i);
+        const std::string destination = fmt::format("{}.{}", path, i + 1);
+        std::rename(source.c_str(), destination.c_str());
+      }
+      std::rename(path.c_str(), fmt::format("{}.1", path).c_str());
+    } else {
+      std::remove(path.c_str());
+    }
+
+    OpenFile();
+  }
+
+  void LoggerRotatingFileSink::WriteBuffer() {
+    const char* data = buffer.data();
+    size_t remaining = buffer.size();
+
+    while(remaining > 0u) {
+      const ssize_t result = ::write(file_descriptor, data, remaining);
+
+      if(result < 0) {
+        if(errno == EINTR) {
+          continue;
+        }
+        // Discard the remaining data rather than retrying forever (e.g. when the disk is full).
+        error_count++;
+        break;
+      }
+
+      data += result;
+      remaining -= (size_t)result;
+    }
+
+    buffer.clear();
+  }
+
+  void LoggerRotatingFileSink::EmergencyFlush(void* user_data) {
+    // Only uses write(), which is async-signal-safe.
+    auto sink = (LoggerRotatingFileSink*)user_data;
+
+    // Claim the buffer for good, so that messages logged during the crash are dropped instead of racing with the write.
+    // If the crash interrupted a message that was being appended (on this or another thread), the buffer may be in an
+    // inconsistent state and the buffered messages are lost instead.
+    if(sink->writing.exchange(true, std::memory_order_acquire)) {
+      return;
+    }
+
+    sink->WriteBuffer();
+    ::fsync(sink->file_descriptor);
+  }
+
+  void LoggerRotatingFileSink::Sync() {
+    WriteBuffer();
+
+    if(::fsync(file_descriptor) != 0) {
+      error_count++;
+    }
+    last_sync_time = Clock::now();
+  }
+
+} // namespace atom
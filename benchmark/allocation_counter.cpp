@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "harness.hpp"
+
+// Replaces the global allocation functions in order to count heap allocations during benchmarks.
+
+namespace atom::benchmark {
+
+  static std::atomic<u64> allocation_count{0};
+
+  u64 get_allocation_count() {
+    return allocation_count.load(std::memory_order_relaxed);
+  }
+
+} // namespace atom::benchmark
+
+void* operator new(std::size_t size) {
+  atom::benchmark::allocation_count.fetch_add(1u, std::memory_order_relaxed);
+
+  if(void* address = std::malloc(size != 0u ? size : 1u)) {
+    return address;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  atom::benchmark::allocation_count.fetch_add(1u, std::memory_order_relaxed);
+
+  const std::size_t alignment_value = (std::size_t)alignment;
+  const std::size_t aligned_size = (std::max<std::size_t>(size, 1u) + alignment_value - 1u) & ~(alignment_value - 1u);
+
+#if defined(_MSC_VER)
+  if(void* address = _aligned_malloc(aligned_size, alignment_value)) {
+#else
+  if(void* address = std::aligned_alloc(alignment_value, aligned_size)) {
+#endif
+    return address;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* address) noexcept {
+  std::free(address);
+}
+
+void operator delete(void* address, std::size_t) noexcept {
+  std::free(address);
+}
+
+void operator delete(void* address, std::align_val_t) noexcept {
+#if defined(_MSC_VER)
+  _aligned_free(address);
+#else
+  std::free(address);
+#endif
+}
+
+void operator delete(void* address, std::size_t, std::align_val_t alignment) noexcept {
+  operator delete(address, alignment);
+}
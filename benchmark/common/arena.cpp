@@ -0,0 +1,61 @@
+#include <atom/arena.hpp>
+
+#include "benchmarks.hpp"
+
+namespace atom::benchmark {
+
+  namespace {
+
+    constexpr size_t k_working_set_size = 256 * 1024 * 1024;
+    constexpr size_t k_element_count = k_working_set_size / sizeof(u64);
+    constexpr int k_accesses_per_iteration = 16;
+
+    const char* get_huge_pages_name(Arena::HugePages huge_pages) {
+      switch(huge_pages) {
+        case Arena::HugePages::None: return "none";
+        case Arena::HugePages::Transparent: return "transparent";
+        case Arena::HugePages::Explicit: return "explicit";
+      }
+      return "unknown";
+    }
+
+    void run_random_access(Reporter& reporter, u64 iterations, Arena::Options const& options) {
+      Arena arena{k_working_set_size, options};
+
+      u64* elements = arena.AllocateArray<u64>(k_element_count);
+      if(elements == nullptr) {
+        return;
+      }
+      for(size_t i = 0; i < k_element_count; i++) {
+        elements[i] = i;
+      }
+
+      // Random read-modify-write accesses across the whole working set mostly miss the TLB with regular pages.
+      u64 state = 0x9E3779B97F4A7C15ull;
+
+      Result result = measure(fmt::format(
+        "arena/random_access/huge_pages={}", get_huge_pages_name(options.huge_pages)), iterations, [&](u64) {
+        for(int i = 0; i < k_accesses_per_iteration; i++) {
+          state ^= state << 13;
+          state ^= state >> 7;
+          state ^= state << 17;
+          elements[state & (k_element_count - 1u)] += state;
+        }
+      });
+      do_not_optimize(elements[state & (k_element_count - 1u)]);
+
+      result.metrics.emplace_back("accesses_per_op", (double)k_accesses_per_iteration);
+      result.metrics.emplace_back("effective_huge_pages", (double)arena.GetHugePages());
+      result.metrics.emplace_back("numa_bound", arena.IsNumaBound() ? 1.0 : 0.0);
+      reporter.Add(std::move(result));
+    }
+
+  } // anonymous namespace
+
+  void run_arena_benchmarks(Reporter& reporter, u64 iterations) {
+    for(const auto huge_pages : {Arena::HugePages::None, Arena::HugePages::Transparent, Arena::HugePages::Explicit}) {
+      run_random_access(reporter, iterations, {.huge_pages = huge_pages, .numa_node = 0});
+    }
+  }
+
+} // namespace atom::benchmark
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <harness.hpp>
+
+namespace atom::benchmark {
+
+  void run_arena_benchmarks(Reporter& reporter, u64 iterations);
+  void run_memory_resource_benchmarks(Reporter& reporter, u64 iterations);
+
+} // namespace atom::benchmark
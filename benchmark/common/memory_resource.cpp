@@ -0,0 +1,86 @@
+#include <atom/arena.hpp>
+#include <atom/arena_memory_resource.hpp>
+#include <atom/chained_arena.hpp>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmarks.hpp"
+
+namespace atom::benchmark {
+
+  namespace {
+
+    // Container-heavy workloads, which resemble the short-lived containers used while handling a request.
+
+    void build_vector(std::pmr::memory_resource* resource, u64 seed) {
+      std::pmr::vector<u64> vector{resource};
+      for(u64 i = 0; i < 256; i++) {
+        vector.push_back(seed + i);
+      }
+      do_not_optimize(vector.data());
+    }
+
+    void build_strings(std::pmr::memory_resource* resource, u64 seed) {
+      std::pmr::vector<std::pmr::string> strings{resource};
+      for(u64 i = 0; i < 32; i++) {
+        std::pmr::string& string = strings.emplace_back("request-header-value-that-does-not-fit-sso-");
+        string += std::to_string(seed + i);
+      }
+      do_not_optimize(strings.data());
+    }
+
+    void build_map(std::pmr::memory_resource* resource, u64 seed) {
+      std::pmr::unordered_map<u64, u64> map{resource};
+      for(u64 i = 0; i < 64; i++) {
+        map.emplace(seed * 64u + i, i);
+      }
+      do_not_optimize(map.size());
+    }
+
+    template<typename Workload>
+    void run_workload(Reporter& reporter, std::string_view workload_name, u64 iterations, Workload&& workload) {
+      reporter.Add(measure(fmt::format("{}/new_delete", workload_name), iterations, [&](u64 i) {
+        workload(std::pmr::new_delete_resource(), i);
+      }));
+
+      {
+        Arena arena{64 * 1024 * 1024};
+        ArenaMemoryResource resource{arena, std::pmr::new_delete_resource()};
+
+        reporter.Add(measure(fmt::format("{}/arena", workload_name), iterations, [&](u64 i) {
+          workload(&resource, i);
+          arena.Reset();
+        }));
+      }
+
+      {
+        ChainedArena arena{};
+        MonotonicArenaMemoryResource resource{arena};
+
+        reporter.Add(measure(fmt::format("{}/chained_arena_monotonic", workload_name), iterations, [&](u64 i) {
+          workload(&resource, i);
+          arena.Reset();
+        }));
+      }
+
+      {
+        std::pmr::monotonic_buffer_resource resource{};
+
+        reporter.Add(measure(fmt::format("{}/std_monotonic_buffer", workload_name), iterations, [&](u64 i) {
+          workload(&resource, i);
+          resource.release();
+        }));
+      }
+    }
+
+  } // anonymous namespace
+
+  void run_memory_resource_benchmarks(Reporter& reporter, u64 iterations) {
+    run_workload(reporter, "pmr/vector", iterations, build_vector);
+    run_workload(reporter, "pmr/strings", iterations, build_strings);
+    run_workload(reporter, "pmr/unordered_map", iterations, build_map);
+  }
+
+} // namespace atom::benchmark
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <atom/integer.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace atom::benchmark {
+
+  /// The measurements of a single benchmark case.
+  struct Result {
+    std::string name;
+    u64 iterations;
+    double seconds;
+    std::vector<std::pair<std::string, double>> metrics{}; ///< additional named measurements
+  };
+
+  /// @returns the number of heap allocations (using operator new) since the start of the program
+  u64 get_allocation_count();
+
+  /// Prevents the compiler from optimizing away the computation of a value.
+  template<typename T>
+  inline void do_not_optimize(T const& value) {
+#if defined(_MSC_VER)
+    static volatile const void* sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+  }
+
+  /**
+   * Measure the throughput of a function.
+   * @param name       the name of the benchmark case
+   * @param iterations the number of times that the function is invoked
+   * @param function   the function, which receives the index of the current iteration
+   */
+  template<typename Function>
+  Result measure(std::string_view name, u64 iterations, Function&& function) {
+    const u64 start_allocation_count = get_allocation_count();
+    const auto start = std::chrono::steady_clock::now();
+
+    for(u64 i = 0; i < iterations; i++) {
+      function(i);
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const u64 allocation_count = get_allocation_count() - start_allocation_count;
+
+    return {
+      std::string{name},
+      iterations,
+      std::chrono::duration<double>(end - start).count(),
+      {{"allocations_per_op", (double)allocation_count / (double)iterations}}
+    };
+  }
+
+  /**
+   * Measure the throughput and the latency distribution of a function, which is invoked from one or more threads.
+   * Each invocation is timed individually, so the latencies include the overhead of reading the clock.
+   * The result carries the latency percentiles (in nanoseconds) as additional metrics.
+   * @param name         the name of the benchmark case
+   * @param iterations   the total number of times that the function is invoked (split evenly between the threads)
+   * @param thread_count the number of threads that invoke the function concurrently
+   * @param function     the function, which receives the index of the current iteration (unique across all threads)
+   */
+  template<typename Function>
+  Result measure_latency(std::string_view name, u64 iterations, int thread_count, Function&& function) {
+    using Clock = std::chrono::steady_clock;
+
+    const u64 iterations_per_thread = iterations / (u64)thread_count;
+
+    std::vector<std::vector<u32>> latencies((size_t)thread_count, std::vector<u32>(iterations_per_thread));
+    std::vector<std::thread> threads{};
+    std::atomic_int ready_count{0};
+    std::atomic_bool start{false};
+
+    const auto run = [&](int thread_index) {
+      std::vector<u32>& thread_latencies = latencies[(size_t)thread_index];
+
+      const u64 first_iteration = (u64)thread_index * iterations_per_thread;
+
+      ready_count.fetch_add(1);
+      while(!start.load(std::memory_order_acquire)) {
+      }
+
+      for(u64 i = 0; i < iterations_per_thread; i++) {
+        const auto call_start = Clock::now();
+        function(first_iteration + i);
+        const auto call_end = Clock::now();
+
+        thread_latencies[i] = (u32)std::min<s64>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(call_end - call_start).count(), 0xFFFFFFFF);
+      }
+    };
+
+    for(int i = 1; i < thread_count; i++) {
+      threads.emplace_back(run, i);
+    }
+
+    while(ready_count.load() < thread_count - 1) {
+    }
+
+    const u64 start_allocation_count = get_allocation_count();
+    const auto start_time = Clock::now();
+    start.store(true, std::memory_order_release);
+    run(0);
+    for(auto& thread : threads) {
+      thread.join();
+    }
+    const auto end_time = Clock::now();
+    const u64 allocation_count = get_allocation_count() - start_allocation_count;
+
+    std::vector<u32> all_latencies{};
+    all_latencies.reserve(iterations_per_thread * (u64)thread_count);
+    for(auto const& thread_latencies : latencies) {
+      all_latencies.insert(all_latencies.end(), thread_latencies.begin(), thread_latencies.end());
+    }
+    std::sort(all_latencies.begin(), all_latencies.end());
+
+    const auto get_percentile = [&](double percentile) -> double {
+      if(all_latencies.empty()) {
+        return 0.0;
+      }
+      return (double)all_latencies[std::min(all_latencies.size() - 1u, (size_t)(percentile * (double)all_latencies.size()))];
+    };
+
+    return {
+      std::string{name},
+      iterations_per_thread * (u64)thread_count,
+      std::chrono::duration<double>(end_time - start_time).count(),
+      {
+        {"threads", (double)thread_count},
+        {"allocations_per_op", (double)allocation_count / (double)(iterations_per_thread * (u64)thread_count)},
+        {"p50_ns", get_percentile(0.5)},
+        {"p99_ns", get_percentile(0.99)},
+        {"p999_ns", get_percentile(0.999)},
+        {"max_ns", all_latencies.empty() ? 0.0 : (double)all_latencies.back()}
+      }
+    };
+  }
+
+  /// Collects the results of benchmark cases and writes them in JSON format.
+  class Reporter {
+    public:
+      /// Add the result of a benchmark case and print a short summary to stderr.
+      void Add(Result result) {
+        fmt::print(stderr, "{:<48} {:>12.2f} ns/op", result.name, GetNanosecondsPerOperation(result));
+        for(const auto& [metric, value] : result.metrics) {
+          fmt::print(stderr, " {}={}", metric, value);
+        }
+        fmt::print(stderr, "\n");
+        m_results.push_back(std::move(result));
+      }
+
+      /// Write all results to a file in JSON format.
+      void WriteJSON(std::FILE* file) const {
+        fmt::print(file, "{{\n  \"benchmarks\": [\n");
+
+        for(size_t i = 0; i < m_results.size(); i++) {
+          const Result& result = m_results[i];
+
+          fmt::print(file, "    {{\"name\": \"{}\", \"iterations\": {}, \"seconds\": {}, \"ns_per_op\": {}, \"ops_per_second\": {}",
+            result.name, result.iterations, result.seconds, GetNanosecondsPerOperation(result), (double)result.iterations / result.seconds);
+
+          for(const auto& [metric, value] : result.metrics) {
+            fmt::print(file, ", \"{}\": {}", metric, value);
+          }
+
+          fmt::print(file, "}}{}\n", i + 1u < m_results.size() ? "," : "");
+        }
+
+        fmt::print(file, "  ]\n}}\n");
+      }
+
+    private:
+      static double GetNanosecondsPerOperation(Result const& result) {
+        return result.seconds * 1e9 / (double)result.iterations;
+      }
+
+      std::vector<Result> m_results{};
+  };
+
+} // namespace atom::benchmark
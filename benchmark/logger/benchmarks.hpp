@@ -0,0 +1,19 @@
+#pragma once
+
+#include <atom/logger/logger.hpp>
+#include <harness.hpp>
+
+namespace atom::benchmark {
+
+  /// A sink that discards all messages, used to measure the cost of the logger front-end.
+  class NullSink final : public Logger::SinkBase {
+    protected:
+      void AppendImpl(Logger::Message const& message) override {
+        do_not_optimize(message.text.data());
+      }
+  };
+
+  void run_format_string_benchmarks(Reporter& reporter, u64 iterations);
+  void run_throughput_benchmarks(Reporter& reporter, u64 iterations);
+
+} // namespace atom::benchmark
@@ -0,0 +1,44 @@
+#include <fmt/compile.h>
+#include <iterator>
+#include <memory>
+
+#include "benchmarks.hpp"
+
+namespace atom::benchmark {
+
+  void run_format_string_benchmarks(Reporter& reporter, u64 iterations) {
+    static constexpr std::string_view k_format = "value {} ratio {:.3f} name {}";
+
+    fmt::memory_buffer buffer;
+
+    reporter.Add(measure("format/runtime", iterations, [&](u64 i) {
+      buffer.clear();
+      fmt::format_to(std::back_inserter(buffer), fmt::runtime(k_format), i, 0.5, "atom");
+      do_not_optimize(buffer.data());
+    }));
+
+    reporter.Add(measure("format/checked", iterations, [&](u64 i) {
+      buffer.clear();
+      fmt::format_to(std::back_inserter(buffer), "value {} ratio {:.3f} name {}", i, 0.5, "atom");
+      do_not_optimize(buffer.data());
+    }));
+
+    reporter.Add(measure("format/compiled", iterations, [&](u64 i) {
+      buffer.clear();
+      fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("value {} ratio {:.3f} name {}"), i, 0.5, "atom");
+      do_not_optimize(buffer.data());
+    }));
+
+    Logger logger{"benchmark"};
+    logger.InstallSink(std::make_shared<NullSink>());
+
+    reporter.Add(measure("log/runtime", iterations, [&](u64 i) {
+      logger.Log<Info>(fmt::runtime(k_format), i, 0.5, "atom");
+    }));
+
+    reporter.Add(measure("log/checked", iterations, [&](u64 i) {
+      logger.Log<Info>("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+    }));
+  }
+
+} // namespace atom::benchmark
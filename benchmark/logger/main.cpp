@@ -0,0 +1,38 @@
+#include <atom/arguments.hpp>
+#include <cstdio>
+#include <string>
+
+#include "benchmarks.hpp"
+
+int main(int argc, char** argv) {
+  atom::Arguments arguments{"atom-logger-benchmark", "Measures the performance of the atom-logger module", {1, 0, 0}};
+
+  std::string output_path;
+  int iterations = 1000000;
+
+  arguments.RegisterArgument(output_path, true, "output", "Write the JSON results to a file instead of stdout", "path");
+  arguments.RegisterArgument(iterations, true, "iterations", "Number of iterations per benchmark case", "count");
+
+  if(!arguments.Parse(argc, argv) || iterations <= 0) {
+    return -1;
+  }
+
+  atom::benchmark::Reporter reporter{};
+
+  atom::benchmark::run_format_string_benchmarks(reporter, (u64)iterations);
+  atom::benchmark::run_throughput_benchmarks(reporter, (u64)iterations);
+
+  if(output_path.empty()) {
+    reporter.WriteJSON(stdout);
+  } else {
+    std::FILE* file = std::fopen(output_path.c_str(), "w");
+    if(file == nullptr) {
+      fmt::print(stderr, "Could not open output file: {}\n", output_path);
+      return -1;
+    }
+    reporter.WriteJSON(file);
+    std::fclose(file);
+  }
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+#include <atom/logger/sink/async.hpp>
+#include <atom/logger/sink/file.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "benchmarks.hpp"
+
+namespace atom::benchmark {
+
+  namespace {
+
+    int get_producer_thread_count() {
+      return (int)std::clamp(std::thread::hardware_concurrency(), 2u, 8u);
+    }
+
+    /**
+     * Measure the cost of logging into an asynchronous sink on the calling (producer) thread only.
+     * Messages are logged in bursts that fit into the ring buffer, and the backend thread drains the ring buffer
+     * between bursts (untimed). This keeps the producer from waiting for the backend thread, whose formatting cost
+     * would otherwise bound the measured throughput.
+     */
+    template<typename Function>
+    Result measure_async_producer(std::string_view name, u64 iterations, Function&& function) {
+      constexpr u64 k_burst_size = 4096;
+
+      auto sink = std::make_shared<LoggerAsyncSink>(std::make_shared<NullSink>(), k_burst_size * 2u);
+
+      Logger logger{"benchmark"};
+      logger.InstallSink(sink);
+
+      std::chrono::steady_clock::duration elapsed{};
+      const u64 start_allocation_count = get_allocation_count();
+
+      for(u64 i = 0; i < iterations; i += k_burst_size) {
+        const u64 burst_end = std::min(i + k_burst_size, iterations);
+        const auto start = std::chrono::steady_clock::now();
+
+        for(u64 j = i; j < burst_end; j++) {
+          function(logger, j);
+        }
+
+        elapsed += std::chrono::steady_clock::now() - start;
+        logger.Flush();
+      }
+
+      const u64 allocation_count = get_allocation_count() - start_allocation_count;
+
+      return {
+        std::string{name},
+        iterations,
+        std::chrono::duration<double>(elapsed).count(),
+        {{"allocations_per_op", (double)allocation_count / (double)iterations}, {"burst_size", (double)k_burst_size}}
+      };
+    }
+
+  } // anonymous namespace
+
+  void run_throughput_benchmarks(Reporter& reporter, u64 iterations) {
+    // Front-end cost depending on the number of installed sinks
+    for(int sink_count : {0, 1, 2, 4, 8}) {
+      Logger logger{"benchmark"};
+      for(int i = 0; i < sink_count; i++) {
+        logger.InstallSink(std::make_shared<NullSink>());
+      }
+
+      reporter.Add(measure_latency(fmt::format("log/null_sinks={}", sink_count), iterations, 1, [&](u64 i) {
+        logger.Log<Info>("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+      }));
+    }
+
+    // Messages that are filtered before formatting
+    {
+      Logger logger{"benchmark"};
+      logger.InstallSink(std::make_shared<NullSink>());
+      logger.SetLogLevelEnable(Info, false);
+
+      reporter.Add(measure_latency("log/runtime_disabled", iterations, 1, [&](u64 i) {
+        logger.Log<Info>("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+      }));
+
+      set_global_log_mask(All & ~Info);
+
+      reporter.Add(measure_latency("macro/globally_disabled", iterations, 1, [&](u64 i) {
+        ATOM_INFO("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+      }));
+
+      set_global_log_mask(All);
+
+#if defined(NDEBUG)
+      reporter.Add(measure_latency("log/compiled_out", iterations, 1, [&](u64 i) {
+        logger.Log<Trace>("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+      }));
+#else
+      fmt::print(stderr, "log/compiled_out is only measured in release builds (NDEBUG)\n");
+#endif
+    }
+
+    // Deferred formatting
+    {
+      Logger logger{"benchmark"};
+      logger.InstallSink(std::make_shared<NullSink>());
+
+      reporter.Add(measure_latency("log_deferred/null_sinks=1", iterations, 1, [&](u64 i) {
+        logger.LogDeferred<Info>("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+      }));
+    }
+
+    // Deferred formatting pays off when a sink moves the formatting off the producer thread.
+    // The null sink above does not accept deferred messages, so they are formatted on the producer thread there.
+    reporter.Add(measure_async_producer("async/log", iterations, [](Logger& logger, u64 i) {
+      logger.Log<Info>("request {} took {:.3f} ms (score {:.6e}, ratio {:.2f}%) path {} status {}", i, 12.5 + (double)i, 1.0 / (double)(i + 1u), 99.5, "/api/v1/items", 200);
+    }));
+
+    reporter.Add(measure_async_producer("async/log_deferred", iterations, [](Logger& logger, u64 i) {
+      logger.LogDeferred<Info>("request {} took {:.3f} ms (score {:.6e}, ratio {:.2f}%) path {} status {}", i, 12.5 + (double)i, 1.0 / (double)(i + 1u), 99.5, "/api/v1/items", 200);
+    }));
+
+    // Null sink against file sink, with a single and with many producer threads
+    const std::filesystem::path file_path = std::filesystem::temp_directory_path() / "atom-logger-benchmark.log";
+
+    const auto run_sink_benchmark = [&](std::string_view sink_name, auto create_sink) {
+      for(int thread_count : {1, get_producer_thread_count()}) {
+        Logger logger{"benchmark"};
+        logger.InstallSink(create_sink());
+
+        reporter.Add(measure_latency(fmt::format("sink/{}/threads={}", sink_name, thread_count), iterations, thread_count, [&](u64 i) {
+          logger.Log<Info>("value {} ratio {:.3f} name {}", i, 0.5, "atom");
+        }));
+
+        logger.Flush();
+      }
+    };
+
+    run_sink_benchmark("null", []() {
+      return std::make_shared<NullSink>();
+    });
+
+    run_sink_benchmark("file", [&]() {
+      return std::make_shared<LoggerFileSink>(file_path.string());
+    });
+
+    run_sink_benchmark("async_file", [&]() {
+      return std::make_shared<LoggerAsyncSink>(std::make_shared<LoggerFileSink>(file_path.string()));
+    });
+
+    std::filesystem::remove(file_path);
+  }
+
+} // namespace atom::benchmark
@@ -0,0 +1,52 @@
+#include <atom/arguments.hpp>
+#include <atom/logger/binary_log.hpp>
+#include <atom/logger/sink/file.hpp>
+#include <cstdio>
+#include <fmt/format.h>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+  atom::Arguments arguments{
+    "atom-log-decode", "Converts a binary log written by atom::LoggerBinarySink into a text log", {1, 0, 0}};
+
+  std::string output_path{};
+
+  arguments.RegisterArgument(output_path, true, "output", "Write the text log to a file instead of stdout", "path");
+  arguments.RegisterFile("binary-log", false);
+
+  std::vector<const char*> files;
+
+  if(!arguments.Parse(argc, argv, &files) || files.empty()) {
+    return -1;
+  }
+
+  std::FILE* input = std::fopen(files[0], "rb");
+
+  if(input == nullptr) {
+    fmt::print(stderr, "Could not open binary log: {}\n", files[0]);
+    return -1;
+  }
+
+  atom::BinaryLogReader reader{input};
+  atom::Logger::Message message{};
+  atom::BinaryLogReader::Status status;
+
+  {
+    // Writes the same text layout as atom::LoggerFileSink does when logging directly to a file.
+    atom::LoggerFileSink output = output_path.empty() ? atom::LoggerFileSink{stdout} : atom::LoggerFileSink{output_path};
+
+    while((status = reader.Next(message)) == atom::BinaryLogReader::Status::Ok) {
+      output.Append(message);
+    }
+  }
+
+  std::fclose(input);
+
+  if(status == atom::BinaryLogReader::Status::Malformed) {
+    fmt::print(stderr, "Binary log is malformed or truncated: {}\n", files[0]);
+    return -1;
+  }
+
+  return 0;
+}